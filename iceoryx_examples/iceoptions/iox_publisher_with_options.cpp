@@ -57,6 +57,10 @@ int main()
     //  we allow the subscribers to block the publisher if they want to ensure that no samples are lost
     publisherOptions.subscriberTooSlowPolicy = iox::popo::SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
 
+    // when the mempool is exhausted, loan waits up to one second for a chunk to be freed instead of failing
+    publisherOptions.memPoolExhaustedPolicy = iox::popo::MemPoolExhaustedPolicy::WAIT_FOR_CHUNK;
+    publisherOptions.loanTimeout = iox::units::Duration::fromSeconds(1);
+
     iox::popo::Publisher<RadarObject> publisher({"Radar", "FrontLeft", "Object"}, publisherOptions);
 
     // we have to explicitely offer the publisher for making it visible to subscribers
@@ -111,11 +111,14 @@ namespace iox
     error(MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS) \
     error(MEPOO__MEMPOOL_CHUNKSIZE_MUST_BE_MULTIPLE_OF_CHUNK_MEMORY_ALIGNMENT) \
     error(MEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL) \
+    error(MEPOO__MEMPOOL_CHUNK_SIZE_EXCEEDS_MAX_CHUNK_SIZE) \
+    error(MEPOO__MEMPOOL_FAILED_TO_CREATE_SEMAPHORE) \
     error(MEPOO__TYPED_MEMPOOL_HAS_INCONSISTENT_STATE) \
     error(MEPOO__TYPED_MEMPOOL_MANAGEMENT_SEGMENT_IS_BROKEN) \
     error(MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT) \
     error(MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY) \
     error(MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT) \
+    error(MEPOO__SEGMENT_EMBEDDED_CHUNK_MANAGEMENT_REQUIRES_SAME_READER_AND_WRITER_GROUP) \
     error(MEPOO__INTROSPECTION_CONTAINER_FULL) \
     error(MEPOO__CANNOT_ALLOCATE_CHUNK) \
     error(MEPOO__MAXIMUM_NUMBER_OF_MEMPOOLS_REACHED) \
@@ -0,0 +1,101 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_BUDDY_FREE_LIST_HPP
+#define IOX_HOOFS_CONCURRENT_BUDDY_FREE_LIST_HPP
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief Lock-free free-list for blocks of different sizes following the buddy system. The list manages a number
+/// of top blocks which consist of 2^(numberOfOrders - 1) blocks of the smallest size each. A block of order 'k'
+/// consists of 2^k blocks of the smallest size and is split into two buddies of order 'k - 1' when a smaller block is
+/// requested; when both buddies are free again they are coalesced.
+///
+/// Every order has a bitmap with one bit per block which is set when the block is free. A block is acquired by
+/// atomically clearing its bit, therefore no locks are required and the structure can be placed in shared memory.
+/// The order of an acquired block is stored so that push does not require the size of the block. Since splitting and
+/// coalescing is not atomic, pop can fail spuriously while other threads concurrently split or coalesce the last free
+/// blocks.
+class BuddyFreeList
+{
+  public:
+    using Index_t = uint32_t;
+    static constexpr uint32_t MAX_NUMBER_OF_ORDERS{24U};
+
+    BuddyFreeList() noexcept = default;
+
+    /// Initializes the buddy free-list with all top blocks being free
+    /// @param [in] memory pointer to a memory with the size calculated by requiredMemorySize()
+    /// @param [in] numberOfTopBlocks is the number of blocks of the highest order
+    /// @param [in] numberOfOrders is the number of block sizes; must be in the range [1, MAX_NUMBER_OF_ORDERS]
+    void init(cxx::not_null<void*> memory, const uint32_t numberOfTopBlocks, const uint32_t numberOfOrders) noexcept;
+
+    /// Pop a block of the given order; if there is no free block of this order, a block of a higher order is split
+    /// @param [in] order of the requested block
+    /// @param [out] index of the first block of the smallest size which is part of the acquired block
+    /// @return true if a block could be acquired, false otherwise
+    bool pop(const uint32_t order, Index_t& index) noexcept;
+
+    /// Push a previously popped block; the block is coalesced with its buddy if the buddy is free
+    /// @param [in] index of the previously popped block
+    /// @return true if index refers to a popped block which was not yet pushed, false otherwise
+    bool push(const Index_t index) noexcept;
+
+    /// Returns the order of a popped block
+    /// @param [in] index of the previously popped block
+    /// @return the order of the block or numberOfOrders if the index does not refer to a popped block
+    uint32_t orderOf(const Index_t index) const noexcept;
+
+    /// Calculates the required memory size for a buddy free-list
+    /// @param [in] numberOfTopBlocks is the number of blocks of the highest order
+    /// @param [in] numberOfOrders is the number of block sizes
+    /// @return the required memory size for a buddy free-list with the requested number of blocks
+    static uint64_t requiredMemorySize(const uint32_t numberOfTopBlocks, const uint32_t numberOfOrders) noexcept;
+
+  private:
+    using Word_t = std::atomic<uint64_t>;
+    using Order_t = std::atomic<uint8_t>;
+    static constexpr uint64_t BITS_PER_WORD{64U};
+    static constexpr uint8_t ACQUIRED_FLAG{0x80U};
+
+    static uint64_t numberOfWords(const uint64_t numberOfBlocks) noexcept;
+    static uint32_t indexOfLowestSetBit(const uint64_t value) noexcept;
+
+    uint64_t numberOfBlocks(const uint32_t order) const noexcept;
+    Word_t& wordOf(const uint32_t order, const uint64_t block) noexcept;
+    bool isFree(const uint32_t order, const uint64_t block) noexcept;
+    bool tryAcquire(const uint32_t order, const uint64_t block) noexcept;
+    void release(const uint32_t order, const uint64_t block) noexcept;
+    bool acquireAnyBlock(const uint32_t order, uint64_t& block) noexcept;
+
+    uint32_t m_numberOfTopBlocks{0U};
+    uint32_t m_numberOfOrders{0U};
+    uint64_t m_bitmapOffset[MAX_NUMBER_OF_ORDERS]{};
+    iox::rp::RelativePointer<Word_t> m_bitmap;
+    iox::rp::RelativePointer<Order_t> m_blockOrder;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_BUDDY_FREE_LIST_HPP
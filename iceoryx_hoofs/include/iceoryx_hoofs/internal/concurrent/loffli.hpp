@@ -89,6 +89,34 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop up to maxCount values from the free-list with a single CAS on the head
+    /// @param [out] indices memory to store the acquired indices; must have space for maxCount elements
+    /// @param [in] maxCount the maximum number of indices to acquire
+    /// @return the number of acquired indices, 0 if the free-list is empty
+    uint32_t popBatch(cxx::not_null<Index_t*> indices, const uint32_t maxCount) noexcept;
+
+    /// Pop up to maxCount values from the free-list with a single CAS on the head; the number of acquired indices is
+    /// stored in acquiredCount directly after the CAS. If acquiredCount and indices are located in shared memory, the
+    /// acquired indices are not lost when the process is terminated before popBatch returns
+    /// @param [out] indices memory to store the acquired indices; must have space for maxCount elements
+    /// @param [in] maxCount the maximum number of indices to acquire
+    /// @param [out] acquiredCount the number of acquired indices, 0 if the free-list is empty
+    void popBatch(cxx::not_null<Index_t*> indices, const uint32_t maxCount, uint32_t& acquiredCount) noexcept;
+
+    /// Marks the indices of a popBatch as acquired; this is done by popBatch itself and only needs to be called when
+    /// popBatch was interrupted after acquiredCount was stored, e.g. since the process was terminated, so that the
+    /// indices can be pushed again
+    /// @param [in] indices the indices which were stored by the interrupted popBatch
+    /// @param [in] count the acquiredCount which was stored by the interrupted popBatch
+    void completePopBatch(cxx::not_null<const Index_t*> indices, const uint32_t count) noexcept;
+
+    /// Push multiple previously poped elements with a single CAS on the head
+    /// @param [in] indices pointer to the previously poped indices
+    /// @param [in] count number of indices to push
+    /// @return true if all indices are valid and not yet pushed, false otherwise; in the latter case
+    ///         none of the indices is pushed
+    bool pushBatch(cxx::not_null<const Index_t*> indices, const uint32_t count) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
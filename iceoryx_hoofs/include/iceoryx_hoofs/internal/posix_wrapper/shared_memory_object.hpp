@@ -39,6 +39,53 @@ enum class SharedMemoryObjectError
     MAPPING_SHARED_MEMORY_FAILED,
 };
 
+/// @brief defines how the pages of a newly created shared memory object are faulted in
+enum class PrefaultMode : uint8_t
+{
+    /// @brief the pages are faulted in on first access
+    NONE,
+    /// @brief the provisioning worker threads write to every page of their part of the shared memory
+    TOUCH_PAGES,
+    /// @brief the shared memory is mapped with MAP_POPULATE and the kernel faults in all pages; falls back to
+    /// TOUCH_PAGES on platforms without MAP_POPULATE
+    POPULATE
+};
+
+/// @brief defines on which NUMA nodes the pages of a newly created shared memory object are placed
+enum class NumaPolicy : uint8_t
+{
+    /// @brief the pages are placed according to the policy of the thread which faults them in
+    DEFAULT,
+    /// @brief the pages are only placed on the given nodes
+    BIND,
+    /// @brief the pages are distributed round-robin over the given nodes
+    INTERLEAVE,
+    /// @brief the pages are placed on the lowest of the given nodes if possible and on other nodes otherwise
+    PREFERRED
+};
+
+/// @brief defines how the memory of a shared memory object is provisioned when it is created; the provisioning is
+/// only done by the owner of the shared memory
+struct SharedMemoryProvisioning
+{
+    static constexpr uint32_t MAX_NUMBER_OF_WORKER_THREADS{64U};
+    static constexpr uint32_t MAX_NUMBER_OF_NUMA_NODES{64U};
+
+    PrefaultMode m_prefaultMode{PrefaultMode::NONE};
+    /// @brief locks the pages of the shared memory in RAM with mlock so that they are not swapped out
+    bool m_lockPages{false};
+    /// @brief a newly created shared memory is already zeroed by the kernel; when zeroing is skipped, running out of
+    /// memory is only detected on first access unless the pages are prefaulted
+    bool m_skipZeroing{false};
+    /// @brief the number of threads which zero, prefault and lock the memory in parallel; clamped to
+    /// [1, MAX_NUMBER_OF_WORKER_THREADS]
+    uint32_t m_numberOfWorkerThreads{1U};
+    /// @brief the NUMA policy is applied before the memory is zeroed or prefaulted
+    NumaPolicy m_numaPolicy{NumaPolicy::DEFAULT};
+    /// @brief contains a bit for each NUMA node the policy refers to, bit n stands for node n
+    uint64_t m_numaNodeMask{0U};
+};
+
 class SharedMemoryObject : public DesignPattern::Creation<SharedMemoryObject, SharedMemoryObjectError>
 {
   public:
@@ -59,6 +106,16 @@ class SharedMemoryObject : public DesignPattern::Creation<SharedMemoryObject, Sh
     int getFileHandle() const noexcept;
     bool hasOwnership() const noexcept;
 
+    /// @brief returns the size of the pages which back the shared memory; this is the huge page size when the
+    ///        shared memory could be backed by huge pages and the default page size of the system otherwise
+    uint64_t getPageSize() const noexcept;
+
+    /// @brief returns the NUMA node on which the first page of the shared memory resides or UNKNOWN_NUMA_NODE when
+    ///        the platform does not support NUMA policies
+    int32_t getNumaNode() const noexcept;
+
+    static constexpr int32_t UNKNOWN_NUMA_NODE{-1};
+
     friend class DesignPattern::Creation<SharedMemoryObject, SharedMemoryObjectError>;
 
   private:
@@ -67,12 +124,25 @@ class SharedMemoryObject : public DesignPattern::Creation<SharedMemoryObject, Sh
                        const AccessMode accessMode,
                        const OpenMode openMode,
                        const void* baseAddressHint,
-                       const mode_t permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP) noexcept;
+                       const mode_t permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP,
+                       const uint64_t hugePageSize = SharedMemory::NO_HUGE_PAGES,
+                       const SharedMemoryProvisioning& provisioning = SharedMemoryProvisioning()) noexcept;
 
     bool isInitialized() const noexcept;
+    bool openAndMapSharedMemory(const SharedMemory::Name_t& name,
+                                const uint64_t memorySizeInBytes,
+                                const AccessMode accessMode,
+                                const OpenMode openMode,
+                                const void* baseAddressHint,
+                                const mode_t permissions,
+                                const uint64_t hugePageSize,
+                                const SharedMemoryProvisioning& provisioning) noexcept;
+    void applyNumaPolicy(const SharedMemoryProvisioning& provisioning) noexcept;
+    void provisionMemory(const SharedMemoryProvisioning& provisioning, const bool writeZeros) noexcept;
 
   private:
-    uint64_t m_memorySizeInBytes;
+    uint64_t m_memorySizeInBytes{0U};
+    uint64_t m_pageSize{0U};
     cxx::optional<SharedMemory> m_sharedMemory;
     cxx::optional<MemoryMap> m_memoryMap;
     cxx::optional<Allocator> m_allocator;
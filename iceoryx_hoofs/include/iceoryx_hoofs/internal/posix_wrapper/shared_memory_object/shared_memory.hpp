@@ -68,11 +68,14 @@ enum class SharedMemoryError
     NO_FILE_RESIZE_SUPPORT,
     NO_RESIZE_SUPPORT,
     INVALID_FILEDESCRIPTOR,
+    NO_HUGE_PAGE_FILESYSTEM,
     UNKNOWN_ERROR
 };
 
 /// @brief Creates a bare metal shared memory object with the posix functions
 ///        shm_open, shm_unlink etc.
+///        When a huge page size is requested the shared memory is created as file in the mounted hugetlbfs
+///        with the requested page size instead.
 ///        It must be used in combination with MemoryMap (or manual mmap calls)
 //         to gain access to the created/opened shared memory
 class SharedMemory : public DesignPattern::Creation<SharedMemory, SharedMemoryError>
@@ -80,7 +83,9 @@ class SharedMemory : public DesignPattern::Creation<SharedMemory, SharedMemoryEr
   public:
     static constexpr uint64_t NAME_SIZE = platform::IOX_MAX_SHM_NAME_LENGTH;
     static constexpr int INVALID_HANDLE = -1;
+    static constexpr uint64_t NO_HUGE_PAGES = 0U;
     using Name_t = cxx::string<NAME_SIZE>;
+    using HugePageFilePath_t = cxx::string<platform::IOX_MAX_PATH_LENGTH + NAME_SIZE>;
 
     SharedMemory(const SharedMemory&) = delete;
     SharedMemory& operator=(const SharedMemory&) = delete;
@@ -98,6 +103,9 @@ class SharedMemory : public DesignPattern::Creation<SharedMemory, SharedMemoryEr
     ///        is opened then this class does not have the ownership.
     bool hasOwnership() const noexcept;
 
+    /// @brief returns the huge page size of the shared memory or NO_HUGE_PAGES when it is backed by default pages
+    uint64_t getHugePageSize() const noexcept;
+
     /// @brief removes shared memory with a given name from the system
     /// @param[in] name name of the shared memory
     /// @return true if the shared memory was removed, false if the shared memory did not exist and
@@ -112,12 +120,15 @@ class SharedMemory : public DesignPattern::Creation<SharedMemory, SharedMemoryEr
     /// @param[in] accessMode defines if the shared memory is mapped read only or with read write rights
     /// @param[in] openMode states how the shared memory is created/opened
     /// @param[in] permissions the permissions the shared memory should have
-    /// @param[in] size the size in bytes of the shared memory
+    /// @param[in] size the size in bytes of the shared memory, must be a multiple of the huge page size if one is
+    ///            requested
+    /// @param[in] hugePageSize the huge page size which backs the shared memory; NO_HUGE_PAGES uses the default pages
     SharedMemory(const Name_t& name,
                  const AccessMode accessMode,
                  const OpenMode openMode,
                  const mode_t permissions,
-                 const uint64_t size) noexcept;
+                 const uint64_t size,
+                 const uint64_t hugePageSize = NO_HUGE_PAGES) noexcept;
 
     bool
     open(const AccessMode accessMode, const OpenMode openMode, const mode_t permissions, const uint64_t size) noexcept;
@@ -126,12 +137,17 @@ class SharedMemory : public DesignPattern::Creation<SharedMemory, SharedMemoryEr
     void destroy() noexcept;
     void reset() noexcept;
     static int getOflagsFor(const AccessMode accessMode, const OpenMode openMode) noexcept;
+    static cxx::expected<bool, SharedMemoryError> unlinkFileIfExist(int (*unlinkFunction)(const char*),
+                                                                    const char* fileName) noexcept;
+    bool initializeHugePageFilePath() noexcept;
 
     static SharedMemoryError errnoToEnum(const int32_t errnum) noexcept;
 
     Name_t m_name;
     int m_handle{INVALID_HANDLE};
     bool m_hasOwnership{false};
+    uint64_t m_hugePageSize{NO_HUGE_PAGES};
+    HugePageFilePath_t m_hugePageFilePath;
 };
 } // namespace posix
 } // namespace iox
@@ -135,6 +135,11 @@ class BaseRelativePointer
     /// @brief unregisters all ptr id pairs (leads to initial state)
     static void unregisterAll() noexcept;
 
+    /// @brief sets the handler which is called to register a segment on demand when the base ptr of an id is
+    /// requested which is not registered
+    /// @param[in] handler which registers the segment of the id and returns its base ptr; nullptr removes the handler
+    static void setUnknownIdHandler(const PointerRepository<id_t, ptr_t>::UnknownIdHandler handler) noexcept;
+
     /// @brief get the offset from id and ptr
     /// @param[in] id is the id of the segment and is used to get the base pointer
     /// @param[in] ptr is the pointer whose offset should be calculated
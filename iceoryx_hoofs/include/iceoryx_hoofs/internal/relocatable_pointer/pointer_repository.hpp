@@ -19,6 +19,7 @@
 #define IOX_HOOFS_RELOCATABLE_POINTER_POINTER_REPOSITORY_HPP
 
 #include "iceoryx_hoofs/cxx/vector.hpp"
+#include <atomic>
 #include <iostream>
 
 #include <assert.h>
@@ -38,7 +39,9 @@ class PointerRepository
   private:
     struct Info
     {
-        ptr_t basePtr{nullptr};
+        /// @note the base pointer is atomic since segments can be registered on demand while other threads
+        /// translate relative pointers of other segments
+        std::atomic<ptr_t> basePtr{nullptr};
         ptr_t endPtr{nullptr};
     };
 
@@ -51,6 +54,10 @@ class PointerRepository
   public:
     static constexpr id_t INVALID_ID = std::numeric_limits<id_t>::max();
 
+    /// @brief is called with an id which is not registered when its base pointer is requested; the handler can map
+    /// the segment of the id, register it and return its base pointer or return nullptr if this is not possible
+    using UnknownIdHandler = ptr_t (*)(const id_t id);
+
     /// @brief default constructor
     PointerRepository() noexcept;
 
@@ -77,11 +84,16 @@ class PointerRepository
     /// @attention the relative pointers corresponding to this id become unsafe to use
     void unregisterAll() noexcept;
 
-    /// @brief gets the base pointer, i.e. the starting address, associated with id
+    /// @brief gets the base pointer, i.e. the starting address, associated with id; if the id is not registered and
+    /// an UnknownIdHandler is set, the base pointer is requested from the handler
     /// @param[in] id is the segment id
     /// @return the base pointer associated with the id
     ptr_t getBasePtr(id_t id) const noexcept;
 
+    /// @brief sets the handler which is called when the base pointer of an id which is not registered is requested
+    /// @param[in] handler which registers the segment of the id on demand; nullptr removes the handler
+    void setUnknownIdHandler(const UnknownIdHandler handler) noexcept;
+
     /// @brief returns the id for a given pointer ptr
     /// @param[in] ptr is the pointer whose corresponding id is searched for
     /// @return the id the pointer was registered to
@@ -96,14 +108,15 @@ class PointerRepository
     void print() const noexcept;
 
   private:
-    /// @todo: if required protect vector against concurrent modification
-    /// whether this is required depends on the use case, we currently do not need it
+    /// @note the registration of different ids can be done concurrently to the lookup, but the registration of ids
+    /// must not be done concurrently; the UnknownIdHandler has to serialize its registrations
     /// we control the ids, so if they are consecutive we only need a vector/array to get the address
     /// this variable exists once per application using relative pointers,
     /// and each needs to initialize it via register calls above
 
     iox::cxx::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+    std::atomic<uint64_t> m_maxRegistered{0U};
+    std::atomic<UnknownIdHandler> m_unknownIdHandler{nullptr};
 };
 
 } // namespace rp
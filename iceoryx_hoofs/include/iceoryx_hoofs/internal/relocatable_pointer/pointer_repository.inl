@@ -37,13 +37,14 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::registerPtr(id_t id, ptr_t
     {
         return false;
     }
-    if (m_info[id].basePtr == nullptr)
+    if (m_info[id].basePtr.load(std::memory_order_relaxed) == nullptr)
     {
-        m_info[id].basePtr = ptr;
+        // the end pointer is set before the base pointer is published
         m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + size - 1U);
-        if (id > m_maxRegistered)
+        m_info[id].basePtr.store(ptr, std::memory_order_release);
+        if (id > m_maxRegistered.load(std::memory_order_relaxed))
         {
-            m_maxRegistered = id;
+            m_maxRegistered.store(id, std::memory_order_release);
         }
         return true;
     }
@@ -55,13 +56,13 @@ inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::registerPtr(const ptr_t pt
 {
     for (id_t id = 1U; id <= MAX_ID; ++id)
     {
-        if (m_info[id].basePtr == nullptr)
+        if (m_info[id].basePtr.load(std::memory_order_relaxed) == nullptr)
         {
-            m_info[id].basePtr = ptr;
             m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + size - 1U);
-            if (id > m_maxRegistered)
+            m_info[id].basePtr.store(ptr, std::memory_order_release);
+            if (id > m_maxRegistered.load(std::memory_order_relaxed))
             {
-                m_maxRegistered = id;
+                m_maxRegistered.store(id, std::memory_order_release);
             }
             return id;
         }
@@ -75,9 +76,9 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(id_t id) noe
 {
     if (id <= MAX_ID && id >= MIN_ID)
     {
-        if (m_info[id].basePtr != nullptr)
+        if (m_info[id].basePtr.load(std::memory_order_relaxed) != nullptr)
         {
-            m_info[id].basePtr = nullptr;
+            m_info[id].basePtr.store(nullptr, std::memory_order_relaxed);
 
             /// @note do not search for next lower registered index but we could do it here
             return true;
@@ -92,9 +93,9 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
 {
     for (auto& info : m_info)
     {
-        info.basePtr = nullptr;
+        info.basePtr.store(nullptr, std::memory_order_relaxed);
     }
-    m_maxRegistered = 0U;
+    m_maxRegistered.store(0U, std::memory_order_relaxed);
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -102,7 +103,16 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(id_t id) const
 {
     if (id <= MAX_ID && id >= MIN_ID)
     {
-        return m_info[id].basePtr;
+        auto basePtr = m_info[id].basePtr.load(std::memory_order_acquire);
+        if (basePtr == nullptr)
+        {
+            auto unknownIdHandler = m_unknownIdHandler.load(std::memory_order_acquire);
+            if (unknownIdHandler != nullptr)
+            {
+                return unknownIdHandler(id);
+            }
+        }
+        return basePtr;
     }
 
     /// @note for id 0 nullptr is returned, meaning we will later interpret a relative pointer by casting the offset
@@ -112,13 +122,21 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(id_t id) const
     return nullptr;
 }
 
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::setUnknownIdHandler(const UnknownIdHandler handler) noexcept
+{
+    m_unknownIdHandler.store(handler, std::memory_order_release);
+}
+
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(ptr_t ptr) const noexcept
 {
-    for (id_t id = 1U; id <= m_maxRegistered; ++id)
+    const uint64_t maxRegistered = m_maxRegistered.load(std::memory_order_acquire);
+    for (id_t id = 1U; id <= maxRegistered; ++id)
     {
         // return first id where the ptr is in the corresponding interval
-        if (ptr >= m_info[id].basePtr && ptr <= m_info[id].endPtr)
+        auto basePtr = m_info[id].basePtr.load(std::memory_order_acquire);
+        if (ptr >= basePtr && ptr <= m_info[id].endPtr)
         {
             return id;
         }
@@ -142,7 +160,7 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::print() const noexcept
 {
     for (id_t id = 0U; id < m_info.size(); ++id)
     {
-        auto ptr = m_info[id].basePtr;
+        auto ptr = m_info[id].basePtr.load(std::memory_order_relaxed);
         if (ptr != nullptr)
         {
             std::cout << id << " ---> " << ptr << std::endl;
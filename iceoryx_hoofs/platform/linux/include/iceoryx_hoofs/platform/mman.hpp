@@ -17,9 +17,31 @@
 #ifndef IOX_HOOFS_LINUX_PLATFORM_MMAN_HPP
 #define IOX_HOOFS_LINUX_PLATFORM_MMAN_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <linux/mempolicy.h>
 #include <sys/mman.h>
 
+/// @brief mmap flag which lets the kernel fault in all pages of the mapping; 0 when the platform does not support it
+#define IOX_MAP_POPULATE MAP_POPULATE
+
+/// @brief NUMA memory policies for iox_numa_bind
+#define IOX_MPOL_PREFERRED MPOL_PREFERRED
+#define IOX_MPOL_BIND MPOL_BIND
+#define IOX_MPOL_INTERLEAVE MPOL_INTERLEAVE
+
 int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
+/// @brief writes the mount point of a hugetlbfs with the given page size into path
+/// @return 0 on success, otherwise -1 and errno is set to ENOENT when no such hugetlbfs is mounted
+int iox_hugetlbfs_mount_point(uint64_t pageSize, char* path, size_t pathLength);
+/// @brief applies the NUMA memory policy to the memory range; pages which are already faulted in are moved
+/// @param[in] policy is one of the IOX_MPOL_* values
+/// @param[in] nodeMask contains a bit for each NUMA node the policy refers to
+/// @return 0 on success, otherwise -1 and errno is set to ENOSYS when NUMA policies are not supported
+int iox_numa_bind(void* addr, size_t length, int policy, uint64_t nodeMask);
+/// @brief writes the NUMA node of the page at the given address into node; the page is faulted in if required
+/// @return 0 on success, otherwise -1 and errno is set to ENOSYS when NUMA policies are not supported
+int iox_numa_node_of_address(void* addr, int* node);
 
 #endif // IOX_HOOFS_LINUX_PLATFORM_MMAN_HPP
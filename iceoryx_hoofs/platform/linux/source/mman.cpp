@@ -16,6 +16,13 @@
 
 #include "iceoryx_hoofs/platform/mman.hpp"
 
+#include <cerrno>
+#include <cstring>
+#include <mntent.h>
+#include <sys/syscall.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
@@ -27,3 +34,52 @@ int iox_shm_unlink(const char* name)
 {
     return shm_unlink(name);
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_hugetlbfs_mount_point(uint64_t pageSize, char* path, size_t pathLength)
+{
+    FILE* mounts = setmntent("/proc/mounts", "r");
+    if (mounts == nullptr)
+    {
+        return -1;
+    }
+
+    int result = -1;
+    struct mntent entry;
+    constexpr size_t MOUNT_ENTRY_BUFFER_SIZE{4096U};
+    char buffer[MOUNT_ENTRY_BUFFER_SIZE];
+    while (getmntent_r(mounts, &entry, buffer, MOUNT_ENTRY_BUFFER_SIZE) != nullptr)
+    {
+        // the block size of a hugetlbfs is its huge page size
+        struct statfs fileSystemInfo;
+        if (strcmp(entry.mnt_type, "hugetlbfs") == 0 && statfs(entry.mnt_dir, &fileSystemInfo) == 0
+            && static_cast<uint64_t>(fileSystemInfo.f_bsize) == pageSize && strlen(entry.mnt_dir) < pathLength)
+        {
+            strncpy(path, entry.mnt_dir, pathLength);
+            result = 0;
+            break;
+        }
+    }
+    endmntent(mounts);
+
+    if (result != 0)
+    {
+        errno = ENOENT;
+    }
+    return result;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_numa_bind(void* addr, size_t length, int policy, uint64_t nodeMask)
+{
+    // the syscalls are used directly to not depend on libnuma
+    unsigned long mask = static_cast<unsigned long>(nodeMask);
+    constexpr unsigned long MAX_NODE{sizeof(mask) * 8U};
+    return static_cast<int>(syscall(SYS_mbind, addr, length, policy, &mask, MAX_NODE, MPOL_MF_MOVE));
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_numa_node_of_address(void* addr, int* node)
+{
+    return static_cast<int>(syscall(SYS_get_mempolicy, node, nullptr, 0UL, addr, MPOL_F_NODE | MPOL_F_ADDR));
+}
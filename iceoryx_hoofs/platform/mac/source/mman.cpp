@@ -37,3 +37,24 @@ int iox_shm_unlink(const char* name)
     }
     return state;
 }
+
+int iox_hugetlbfs_mount_point(uint64_t, char*, size_t)
+{
+    // hugetlbfs is not available on this platform
+    errno = ENOENT;
+    return -1;
+}
+
+int iox_numa_bind(void*, size_t, int, uint64_t)
+{
+    // NUMA policies are not supported on this platform
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_numa_node_of_address(void*, int*)
+{
+    // NUMA policies are not supported on this platform
+    errno = ENOSYS;
+    return -1;
+}
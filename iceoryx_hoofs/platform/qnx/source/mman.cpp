@@ -16,6 +16,8 @@
 
 #include "iceoryx_hoofs/platform/mman.hpp"
 
+#include <cerrno>
+
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
     return shm_open(name, oflag, mode);
@@ -25,3 +27,24 @@ int iox_shm_unlink(const char* name)
 {
     return shm_unlink(name);
 }
+
+int iox_hugetlbfs_mount_point(uint64_t, char*, size_t)
+{
+    // hugetlbfs is not available on this platform
+    errno = ENOENT;
+    return -1;
+}
+
+int iox_numa_bind(void*, size_t, int, uint64_t)
+{
+    // NUMA policies are not supported on this platform
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_numa_node_of_address(void*, int*)
+{
+    // NUMA policies are not supported on this platform
+    errno = ENOSYS;
+    return -1;
+}
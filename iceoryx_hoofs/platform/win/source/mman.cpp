@@ -15,6 +15,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/platform/mman.hpp"
+
+#include <cerrno>
 #include "iceoryx_hoofs/platform/handle_translator.hpp"
 #include "iceoryx_hoofs/platform/platform_settings.hpp"
 #include "iceoryx_hoofs/platform/win32_errorHandling.hpp"
@@ -55,6 +57,13 @@ int munmap(void* addr, size_t length)
     return -1;
 }
 
+int mlock(const void* addr, size_t length)
+{
+    // a view of a file mapping cannot be locked with VirtualLock without adjusting the working set size
+    errno = ENOTSUP;
+    return -1;
+}
+
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
     HANDLE sharedMemoryHandle{nullptr};
@@ -122,3 +131,24 @@ int iox_shm_unlink(const char* name)
     errno = ENOENT;
     return -1;
 }
+
+int iox_hugetlbfs_mount_point(uint64_t, char*, size_t)
+{
+    // hugetlbfs is not available on this platform
+    errno = ENOENT;
+    return -1;
+}
+
+int iox_numa_bind(void*, size_t, int, uint64_t)
+{
+    // NUMA policies are not supported on this platform
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_numa_node_of_address(void*, int*)
+{
+    // NUMA policies are not supported on this platform
+    errno = ENOSYS;
+    return -1;
+}
@@ -0,0 +1,263 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/buddy_free_list.hpp"
+
+#include <limits>
+#include <new>
+
+namespace iox
+{
+namespace concurrent
+{
+constexpr uint32_t BuddyFreeList::MAX_NUMBER_OF_ORDERS;
+constexpr uint64_t BuddyFreeList::BITS_PER_WORD;
+constexpr uint8_t BuddyFreeList::ACQUIRED_FLAG;
+
+uint64_t BuddyFreeList::numberOfWords(const uint64_t numberOfBlocks) noexcept
+{
+    return (numberOfBlocks + BITS_PER_WORD - 1U) / BITS_PER_WORD;
+}
+
+uint64_t BuddyFreeList::requiredMemorySize(const uint32_t numberOfTopBlocks, const uint32_t numberOfOrders) noexcept
+{
+    uint64_t numberOfBitmapWords{0U};
+    for (uint32_t order = 0U; order < numberOfOrders; ++order)
+    {
+        numberOfBitmapWords += numberOfWords(static_cast<uint64_t>(numberOfTopBlocks) << (numberOfOrders - 1U - order));
+    }
+    const uint64_t numberOfSmallestBlocks = static_cast<uint64_t>(numberOfTopBlocks) << (numberOfOrders - 1U);
+    return numberOfBitmapWords * sizeof(Word_t) + numberOfSmallestBlocks * sizeof(Order_t);
+}
+
+void BuddyFreeList::init(cxx::not_null<void*> memory,
+                         const uint32_t numberOfTopBlocks,
+                         const uint32_t numberOfOrders) noexcept
+{
+    cxx::Expects(numberOfTopBlocks > 0U && "A buddy free-list without blocks is not supported!");
+    cxx::Expects(numberOfOrders > 0U && numberOfOrders <= MAX_NUMBER_OF_ORDERS && "Number of orders exceeds limits!");
+    cxx::Expects((static_cast<uint64_t>(numberOfTopBlocks) << (numberOfOrders - 1U))
+                     <= std::numeric_limits<Index_t>::max()
+                 && "Number of blocks exceeds limits!");
+    cxx::Expects(Word_t().is_lock_free() && "std::atomic<uint64_t> must be lock-free!");
+
+    m_numberOfTopBlocks = numberOfTopBlocks;
+    m_numberOfOrders = numberOfOrders;
+
+    uint64_t numberOfBitmapWords{0U};
+    for (uint32_t order = 0U; order < m_numberOfOrders; ++order)
+    {
+        m_bitmapOffset[order] = numberOfBitmapWords;
+        numberOfBitmapWords += numberOfWords(numberOfBlocks(order));
+    }
+
+    auto bitmap = static_cast<Word_t*>(static_cast<void*>(memory));
+    for (uint64_t i = 0U; i < numberOfBitmapWords; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit is set by requiredMemorySize
+        new (&bitmap[i]) Word_t(0U);
+    }
+    m_bitmap = bitmap;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit is set by requiredMemorySize
+    auto blockOrder = static_cast<Order_t*>(static_cast<void*>(bitmap + numberOfBitmapWords));
+    const uint64_t numberOfSmallestBlocks = numberOfBlocks(0U);
+    for (uint64_t i = 0U; i < numberOfSmallestBlocks; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit is set by requiredMemorySize
+        new (&blockOrder[i]) Order_t(0U);
+    }
+    m_blockOrder = blockOrder;
+
+    // initially only the top blocks are free
+    const uint32_t topOrder = m_numberOfOrders - 1U;
+    for (uint64_t block = 0U; block < m_numberOfTopBlocks; ++block)
+    {
+        release(topOrder, block);
+    }
+}
+
+uint64_t BuddyFreeList::numberOfBlocks(const uint32_t order) const noexcept
+{
+    return static_cast<uint64_t>(m_numberOfTopBlocks) << (m_numberOfOrders - 1U - order);
+}
+
+uint32_t BuddyFreeList::indexOfLowestSetBit(const uint64_t value) noexcept
+{
+    // isolate the lowest set bit and determine its position with a binary search in order to be independent of
+    // compiler intrinsics
+    uint64_t lowestBit = value & (~value + 1U);
+    uint32_t position{0U};
+    for (uint32_t shift = 32U; shift > 0U; shift >>= 1U)
+    {
+        if (lowestBit >= (1ULL << shift))
+        {
+            lowestBit >>= shift;
+            position += shift;
+        }
+    }
+    return position;
+}
+
+BuddyFreeList::Word_t& BuddyFreeList::wordOf(const uint32_t order, const uint64_t block) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit is set by numberOfBlocks
+    return m_bitmap[m_bitmapOffset[order] + block / BITS_PER_WORD];
+}
+
+bool BuddyFreeList::isFree(const uint32_t order, const uint64_t block) noexcept
+{
+    return (wordOf(order, block).load() & (1ULL << (block % BITS_PER_WORD))) != 0U;
+}
+
+bool BuddyFreeList::tryAcquire(const uint32_t order, const uint64_t block) noexcept
+{
+    const uint64_t bit = 1ULL << (block % BITS_PER_WORD);
+    return (wordOf(order, block).fetch_and(~bit) & bit) != 0U;
+}
+
+void BuddyFreeList::release(const uint32_t order, const uint64_t block) noexcept
+{
+    wordOf(order, block).fetch_or(1ULL << (block % BITS_PER_WORD));
+}
+
+bool BuddyFreeList::acquireAnyBlock(const uint32_t order, uint64_t& block) noexcept
+{
+    const uint64_t numberOfBitmapWords = numberOfWords(numberOfBlocks(order));
+    for (uint64_t i = 0U; i < numberOfBitmapWords; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit is set by numberOfBlocks
+        Word_t& word = m_bitmap[m_bitmapOffset[order] + i];
+        uint64_t value = word.load(std::memory_order_relaxed);
+        while (value != 0U)
+        {
+            const uint64_t bit = value & (~value + 1U);
+            const uint64_t previousValue = word.fetch_and(~bit, std::memory_order_acquire);
+            if ((previousValue & bit) != 0U)
+            {
+                block = i * BITS_PER_WORD + indexOfLowestSetBit(bit);
+                return true;
+            }
+            // another thread acquired the block in the meantime
+            value = previousValue & ~bit;
+        }
+    }
+    return false;
+}
+
+bool BuddyFreeList::pop(const uint32_t order, Index_t& index) noexcept
+{
+    if (order >= m_numberOfOrders)
+    {
+        return false;
+    }
+
+    // the smallest free block which is large enough is split to reduce the fragmentation
+    uint64_t block{0U};
+    uint32_t acquiredOrder = order;
+    while (!acquireAnyBlock(acquiredOrder, block))
+    {
+        ++acquiredOrder;
+        if (acquiredOrder >= m_numberOfOrders)
+        {
+            return false;
+        }
+    }
+
+    while (acquiredOrder > order)
+    {
+        // keep the lower half and release the upper half as free buddy
+        --acquiredOrder;
+        block *= 2U;
+        release(acquiredOrder, block + 1U);
+    }
+
+    index = static_cast<Index_t>(block << order);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit is set by numberOfBlocks
+    m_blockOrder[index].store(static_cast<uint8_t>(order | ACQUIRED_FLAG), std::memory_order_release);
+    return true;
+}
+
+uint32_t BuddyFreeList::orderOf(const Index_t index) const noexcept
+{
+    if (index >= numberOfBlocks(0U))
+    {
+        return m_numberOfOrders;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit is checked above
+    const uint8_t blockOrder = m_blockOrder[index].load(std::memory_order_acquire);
+    return ((blockOrder & ACQUIRED_FLAG) != 0U) ? static_cast<uint32_t>(blockOrder & ~ACQUIRED_FLAG) : m_numberOfOrders;
+}
+
+bool BuddyFreeList::push(const Index_t index) noexcept
+{
+    if (index >= numberOfBlocks(0U))
+    {
+        return false;
+    }
+
+    // the acquired flag is reset atomically to detect a double free
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit is checked above
+    Order_t& blockOrder = m_blockOrder[index];
+    uint8_t acquiredOrder = blockOrder.load(std::memory_order_acquire);
+    do
+    {
+        if ((acquiredOrder & ACQUIRED_FLAG) == 0U)
+        {
+            return false;
+        }
+    } while (!blockOrder.compare_exchange_weak(acquiredOrder,
+                                               static_cast<uint8_t>(acquiredOrder & ~ACQUIRED_FLAG),
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_acquire));
+
+    // the order is only stored with the acquired flag at the first index of a popped block, therefore the index is
+    // a multiple of the block size
+    uint32_t order = static_cast<uint32_t>(acquiredOrder & ~ACQUIRED_FLAG);
+    uint64_t block = static_cast<uint64_t>(index) >> order;
+
+    const uint32_t topOrder = m_numberOfOrders - 1U;
+    while (true)
+    {
+        // the block is released before its buddy is checked and both use sequentially consistent operations; when
+        // two buddies are pushed concurrently, at least one of them sees the other one as free and coalesces them
+        release(order, block);
+        if (order == topOrder || !isFree(order, block ^ 1U))
+        {
+            return true;
+        }
+
+        // both buddies are acquired in the same order, starting with the lower one, so that only one of the
+        // concurrently pushing threads coalesces them
+        const uint64_t lowerBuddy = block & ~1ULL;
+        if (!tryAcquire(order, lowerBuddy))
+        {
+            return true;
+        }
+        if (!tryAcquire(order, lowerBuddy + 1U))
+        {
+            // the upper buddy was acquired by pop in the meantime
+            release(order, lowerBuddy);
+            return true;
+        }
+
+        block = lowerBuddy / 2U;
+        ++order;
+    }
+}
+
+} // namespace concurrent
+} // namespace iox
@@ -109,5 +109,117 @@ bool LoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t LoFFLi::popBatch(cxx::not_null<Index_t*> indices, const uint32_t maxCount) noexcept
+{
+    uint32_t acquiredCount{0U};
+    popBatch(indices, maxCount, acquiredCount);
+    return acquiredCount;
+}
+
+void LoFFLi::popBatch(cxx::not_null<Index_t*> indices, const uint32_t maxCount, uint32_t& acquiredCount) noexcept
+{
+    Index_t* acquiredIndices = indices;
+    uint32_t count{0U};
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        /// the chain is read while other threads might modify it; this is fine since every
+        /// modification changes the head and the CAS fails in that case
+        count = 0U;
+        Index_t nextIndex = oldHead.indexToNextFreeIndex;
+        while (count < maxCount && nextIndex < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by maxCount
+            acquiredIndices[count] = nextIndex;
+            ++count;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            nextIndex = m_nextFreeIndex[nextIndex];
+        }
+
+        if (count == 0U)
+        {
+            acquiredCount = 0U;
+            return;
+        }
+
+        newHead.indexToNextFreeIndex = nextIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    /// the indices are owned by the caller from now on, publish them before anything else is done
+    acquiredCount = count;
+
+    completePopBatch(acquiredIndices, count);
+}
+
+void LoFFLi::completePopBatch(cxx::not_null<const Index_t*> indices, const uint32_t count) noexcept
+{
+    const Index_t* acquiredIndices = indices;
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by count
+        const Index_t index = acquiredIndices[i];
+        if (index < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+            m_nextFreeIndex[index] = m_invalidIndex;
+        }
+    }
+
+    /// same synchronization as in pop
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+bool LoFFLi::pushBatch(cxx::not_null<const Index_t*> indices, const uint32_t count) noexcept
+{
+    const Index_t* releasedIndices = indices;
+    if (count == 0U)
+    {
+        return true;
+    }
+
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    /// link the indices to a local chain; every index is validated like in push and a duplicate within the batch is
+    /// detected since the linking of the first occurrence already invalidated its m_invalidIndex marker
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by count
+        const Index_t index = releasedIndices[i];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        if (index >= m_size || m_nextFreeIndex[index] != m_invalidIndex)
+        {
+            for (uint32_t k = 0U; k < i; ++k)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) already validated indices
+                m_nextFreeIndex[releasedIndices[k]] = m_invalidIndex;
+            }
+            return false;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex[index] = (i + 1U < count) ? releasedIndices[i + 1U] : m_size;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by count
+    const Index_t lastIndex = releasedIndices[count - 1U];
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = releasedIndices[0];
+        newHead.abaCounter += 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
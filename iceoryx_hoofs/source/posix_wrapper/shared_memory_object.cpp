@@ -17,21 +17,32 @@
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/platform/fcntl.hpp"
+#include "iceoryx_hoofs/platform/mman.hpp"
 #include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <bitset>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <mutex>
+#include <thread>
 
 namespace iox
 {
 namespace posix
 {
 constexpr void* SharedMemoryObject::NO_ADDRESS_HINT;
+constexpr uint32_t SharedMemoryProvisioning::MAX_NUMBER_OF_WORKER_THREADS;
+constexpr uint32_t SharedMemoryProvisioning::MAX_NUMBER_OF_NUMA_NODES;
+constexpr int32_t SharedMemoryObject::UNKNOWN_NUMA_NODE;
 constexpr uint64_t SIGBUS_ERROR_MESSAGE_LENGTH = 1024U + platform::IOX_MAX_SHM_NAME_LENGTH;
 
 static char sigbusErrorMessage[SIGBUS_ERROR_MESSAGE_LENGTH];
@@ -51,29 +62,41 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
                                        const AccessMode accessMode,
                                        const OpenMode openMode,
                                        const void* baseAddressHint,
-                                       const mode_t permissions) noexcept
-    : m_memorySizeInBytes(cxx::align(memorySizeInBytes, Allocator::MEMORY_ALIGNMENT))
+                                       const mode_t permissions,
+                                       const uint64_t hugePageSize,
+                                       const SharedMemoryProvisioning& provisioning) noexcept
 {
-    m_isInitialized = true;
+    m_isInitialized = false;
 
-    SharedMemory::create(name, accessMode, openMode, permissions, m_memorySizeInBytes)
-        .and_then([this](auto& sharedMemory) { m_sharedMemory.emplace(std::move(sharedMemory)); })
-        .or_else([this](auto&) {
-            std::cerr << "Unable to create SharedMemoryObject since we could not acquire a SharedMemory resource"
-                      << std::endl;
-            m_isInitialized = false;
-            m_errorValue = SharedMemoryObjectError::SHARED_MEMORY_CREATION_FAILED;
-        });
+    if (hugePageSize != SharedMemory::NO_HUGE_PAGES)
+    {
+        m_isInitialized = openAndMapSharedMemory(name,
+                                                 cxx::align(memorySizeInBytes, hugePageSize),
+                                                 accessMode,
+                                                 openMode,
+                                                 baseAddressHint,
+                                                 permissions,
+                                                 hugePageSize,
+                                                 provisioning);
+        if (!m_isInitialized && openMode != OpenMode::OPEN_EXISTING)
+        {
+            std::clog << "Unable to back the shared memory [" << name << "] with huge pages of " << hugePageSize
+                      << " bytes, falling back to the default page size" << std::endl;
+        }
+    }
 
-    if (m_isInitialized)
+    // an existing shared memory must be opened with the page size it was created with; only the creator may fall
+    // back to the default page size
+    if (!m_isInitialized && (hugePageSize == SharedMemory::NO_HUGE_PAGES || openMode != OpenMode::OPEN_EXISTING))
     {
-        MemoryMap::create(baseAddressHint, m_memorySizeInBytes, m_sharedMemory->getHandle(), accessMode, MAP_SHARED, 0)
-            .and_then([this](auto& memoryMap) { m_memoryMap.emplace(std::move(memoryMap)); })
-            .or_else([this](auto) {
-                std::cerr << "Failed to map created shared memory into process!" << std::endl;
-                m_isInitialized = false;
-                m_errorValue = SharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED;
-            });
+        m_isInitialized = openAndMapSharedMemory(name,
+                                                 cxx::align(memorySizeInBytes, Allocator::MEMORY_ALIGNMENT),
+                                                 accessMode,
+                                                 openMode,
+                                                 baseAddressHint,
+                                                 permissions,
+                                                 SharedMemory::NO_HUGE_PAGES,
+                                                 provisioning);
     }
 
     if (!m_isInitialized)
@@ -84,7 +107,8 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
                   << ", access mode = " << ACCESS_MODE_STRING[static_cast<uint64_t>(accessMode)]
                   << ", open mode = " << OPEN_MODE_STRING[static_cast<uint64_t>(openMode)]
                   << ", baseAddressHint = " << std::hex << baseAddressHint << std::dec
-                  << ", permissions = " << std::bitset<sizeof(mode_t)>(permissions) << " ]" << std::endl;
+                  << ", permissions = " << std::bitset<sizeof(mode_t)>(permissions)
+                  << ", hugePageSize = " << hugePageSize << " ]" << std::endl;
         std::cerr.setf(flags);
         return;
     }
@@ -94,33 +118,191 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
     if (m_isInitialized && m_sharedMemory->hasOwnership())
     {
         std::clog << "Reserving " << m_memorySizeInBytes << " bytes in the shared memory [" << name << "]" << std::endl;
-        if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
+        // the policy must be in place before the pages are faulted in by zeroing or prefaulting
+        applyNumaPolicy(provisioning);
+        const bool writeZeros = platform::IOX_SHM_WRITE_ZEROS_ON_CREATION && !provisioning.m_skipZeroing;
+        if (writeZeros || provisioning.m_prefaultMode != PrefaultMode::NONE || provisioning.m_lockPages)
         {
             // this lock is required for the case that multiple threads are creating multiple
             // shared memory objects concurrently
             std::lock_guard<std::mutex> lock(sigbusHandlerMutex);
             auto memsetSigbusGuard = registerSignalHandler(Signal::BUS, memsetSigbusHandler);
 
-            snprintf(
-                sigbusErrorMessage,
-                SIGBUS_ERROR_MESSAGE_LENGTH,
-                "While setting the acquired shared memory to zero a fatal SIGBUS signal appeared caused by memset. The "
-                "shared memory object with the following properties [ name = %s, sizeInBytes = %llu, access mode = %s, "
-                "open mode = %s, baseAddressHint = %p, permissions = %lu ] maybe requires more memory than it is "
-                "currently available in the system.\n",
-                name.c_str(),
-                static_cast<unsigned long long>(memorySizeInBytes),
-                ACCESS_MODE_STRING[static_cast<uint64_t>(accessMode)],
-                OPEN_MODE_STRING[static_cast<uint64_t>(openMode)],
-                baseAddressHint,
-                std::bitset<sizeof(mode_t)>(permissions).to_ulong());
-
-            memset(m_memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
+            snprintf(sigbusErrorMessage,
+                     SIGBUS_ERROR_MESSAGE_LENGTH,
+                     "While setting the acquired shared memory to zero or prefaulting it a fatal SIGBUS signal "
+                     "appeared. The shared memory object with the following properties [ name = %s, sizeInBytes = "
+                     "%llu, access mode = %s, open mode = %s, baseAddressHint = %p, permissions = %lu ] maybe requires "
+                     "more memory than it is currently available in the system.\n",
+                     name.c_str(),
+                     static_cast<unsigned long long>(memorySizeInBytes),
+                     ACCESS_MODE_STRING[static_cast<uint64_t>(accessMode)],
+                     OPEN_MODE_STRING[static_cast<uint64_t>(openMode)],
+                     baseAddressHint,
+                     std::bitset<sizeof(mode_t)>(permissions).to_ulong());
+
+            auto provisioningStart = std::chrono::steady_clock::now();
+            provisionMemory(provisioning, writeZeros);
+            auto provisioningDuration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - provisioningStart);
+            std::clog << "Provisioning the shared memory [" << name << "] took " << provisioningDuration.count()
+                      << " ms" << std::endl;
         }
         std::clog << "[ Reserving shared memory successful ] " << std::endl;
     }
 }
 
+void SharedMemoryObject::applyNumaPolicy(const SharedMemoryProvisioning& provisioning) noexcept
+{
+    if (provisioning.m_numaPolicy == NumaPolicy::DEFAULT)
+    {
+        return;
+    }
+
+    int policy{IOX_MPOL_BIND};
+    switch (provisioning.m_numaPolicy)
+    {
+    case NumaPolicy::INTERLEAVE:
+        policy = IOX_MPOL_INTERLEAVE;
+        break;
+    case NumaPolicy::PREFERRED:
+        policy = IOX_MPOL_PREFERRED;
+        break;
+    default:
+        break;
+    }
+
+    if (posixCall(iox_numa_bind)(
+            m_memoryMap->getBaseAddress(), m_memorySizeInBytes, policy, provisioning.m_numaNodeMask)
+            .failureReturnValue(-1)
+            .evaluate()
+            .has_error())
+    {
+        std::cerr << "Unable to apply the NUMA policy to the shared memory, the pages are placed by the default policy"
+                  << std::endl;
+    }
+}
+
+void SharedMemoryObject::provisionMemory(const SharedMemoryProvisioning& provisioning, const bool writeZeros) noexcept
+{
+    // when MAP_POPULATE is not available or the pages must be placed according to a NUMA policy which can only be
+    // applied after the mapping, the pages are touched by the worker threads instead
+    const bool touchPages = (provisioning.m_prefaultMode == PrefaultMode::TOUCH_PAGES)
+                            || (provisioning.m_prefaultMode == PrefaultMode::POPULATE
+                                && (IOX_MAP_POPULATE == 0 || provisioning.m_numaPolicy != NumaPolicy::DEFAULT));
+
+    if (!writeZeros && !touchPages && !provisioning.m_lockPages)
+    {
+        return;
+    }
+
+    const uint64_t numberOfPages = cxx::align(m_memorySizeInBytes, m_pageSize) / m_pageSize;
+    const uint64_t numberOfWorkerThreads = std::max<uint64_t>(
+        1U,
+        std::min<uint64_t>({provisioning.m_numberOfWorkerThreads,
+                            SharedMemoryProvisioning::MAX_NUMBER_OF_WORKER_THREADS,
+                            numberOfPages}));
+    // the memory is split at page boundaries so that no page is touched by more than one thread
+    const uint64_t pagesPerThread = (numberOfPages + numberOfWorkerThreads - 1U) / numberOfWorkerThreads;
+    auto baseAddress = static_cast<uint8_t*>(m_memoryMap->getBaseAddress());
+
+    std::atomic<uint64_t> numberOfLockFailures{0U};
+    auto provisionRange = [&](const uint64_t firstPage) {
+        const uint64_t begin = firstPage * m_pageSize;
+        const uint64_t end = std::min(begin + pagesPerThread * m_pageSize, m_memorySizeInBytes);
+        if (begin >= end)
+        {
+            return;
+        }
+
+        if (writeZeros)
+        {
+            memset(baseAddress + begin, 0, end - begin);
+        }
+        else if (touchPages)
+        {
+            // the memory of a newly created shared memory is already zeroed, writing zeros faults in the page
+            for (uint64_t offset = begin; offset < end; offset += m_pageSize)
+            {
+                *static_cast<volatile uint8_t*>(baseAddress + offset) = 0U;
+            }
+        }
+
+        if (provisioning.m_lockPages && mlock(baseAddress + begin, end - begin) != 0)
+        {
+            numberOfLockFailures.fetch_add(1U, std::memory_order_relaxed);
+        }
+    };
+
+    cxx::vector<std::thread, SharedMemoryProvisioning::MAX_NUMBER_OF_WORKER_THREADS> workerThreads;
+    for (uint64_t i = 1U; i < numberOfWorkerThreads; ++i)
+    {
+        workerThreads.emplace_back(provisionRange, i * pagesPerThread);
+    }
+    provisionRange(0U);
+    for (auto& thread : workerThreads)
+    {
+        thread.join();
+    }
+
+    if (numberOfLockFailures.load(std::memory_order_relaxed) != 0U)
+    {
+        std::cerr << "Unable to lock all pages of the shared memory in RAM, the pages might be swapped out. Check "
+                     "RLIMIT_MEMLOCK and the CAP_IPC_LOCK capability."
+                  << std::endl;
+    }
+}
+
+// NOLINTNEXTLINE(readability-function-size) todo(iox-#832): make a struct out of arguments
+bool SharedMemoryObject::openAndMapSharedMemory(const SharedMemory::Name_t& name,
+                                                const uint64_t memorySizeInBytes,
+                                                const AccessMode accessMode,
+                                                const OpenMode openMode,
+                                                const void* baseAddressHint,
+                                                const mode_t permissions,
+                                                const uint64_t hugePageSize,
+                                                const SharedMemoryProvisioning& provisioning) noexcept
+{
+    m_memoryMap.reset();
+    m_sharedMemory.reset();
+
+    if (SharedMemory::create(name, accessMode, openMode, permissions, memorySizeInBytes, hugePageSize)
+            .and_then([this](auto& sharedMemory) { m_sharedMemory.emplace(std::move(sharedMemory)); })
+            .or_else([this](auto&) {
+                std::cerr << "Unable to create SharedMemoryObject since we could not acquire a SharedMemory resource"
+                          << std::endl;
+                m_errorValue = SharedMemoryObjectError::SHARED_MEMORY_CREATION_FAILED;
+            })
+            .has_error())
+    {
+        return false;
+    }
+
+    // only the owner provisions the memory, the others would fault in the pages of a possibly huge segment; with a
+    // NUMA policy the pages are faulted in after the policy is applied
+    const int32_t populateFlag = (provisioning.m_prefaultMode == PrefaultMode::POPULATE
+                                  && provisioning.m_numaPolicy == NumaPolicy::DEFAULT && m_sharedMemory->hasOwnership())
+                                     ? IOX_MAP_POPULATE
+                                     : 0;
+    if (MemoryMap::create(
+            baseAddressHint, memorySizeInBytes, m_sharedMemory->getHandle(), accessMode, MAP_SHARED | populateFlag, 0)
+            .and_then([this](auto& memoryMap) { m_memoryMap.emplace(std::move(memoryMap)); })
+            .or_else([this](auto) {
+                std::cerr << "Failed to map created shared memory into process!" << std::endl;
+                m_errorValue = SharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED;
+            })
+            .has_error())
+    {
+        // releases the shared memory and removes it when we are the owner
+        m_sharedMemory.reset();
+        return false;
+    }
+
+    m_memorySizeInBytes = memorySizeInBytes;
+    m_pageSize = (hugePageSize == SharedMemory::NO_HUGE_PAGES) ? pageSize() : hugePageSize;
+    return true;
+}
+
 void* SharedMemoryObject::allocate(const uint64_t size, const uint64_t alignment) noexcept
 {
     return m_allocator->allocate(size, alignment);
@@ -161,6 +343,21 @@ bool SharedMemoryObject::hasOwnership() const noexcept
     return m_sharedMemory->hasOwnership();
 }
 
+uint64_t SharedMemoryObject::getPageSize() const noexcept
+{
+    return m_pageSize;
+}
+
+int32_t SharedMemoryObject::getNumaNode() const noexcept
+{
+    int node{UNKNOWN_NUMA_NODE};
+    auto result = posixCall(iox_numa_node_of_address)(m_memoryMap->getBaseAddress(), &node)
+                      .failureReturnValue(-1)
+                      .suppressErrorMessagesForErrnos(ENOSYS)
+                      .evaluate();
+    return result.has_error() ? UNKNOWN_NUMA_NODE : static_cast<int32_t>(node);
+}
+
 
 } // namespace posix
 } // namespace iox
@@ -33,12 +33,16 @@ namespace iox
 {
 namespace posix
 {
+constexpr uint64_t SharedMemory::NO_HUGE_PAGES;
+
 // NOLINTNEXTLINE(readability-function-size) todo(iox-#832): make a struct out of arguments
 SharedMemory::SharedMemory(const Name_t& name,
                            const AccessMode accessMode,
                            const OpenMode openMode,
                            const mode_t permissions,
-                           const uint64_t size) noexcept
+                           const uint64_t size,
+                           const uint64_t hugePageSize) noexcept
+    : m_hugePageSize(hugePageSize)
 {
     m_isInitialized = true;
     // on qnx the current working directory will be added to the /dev/shmem path if the leading slash is missing
@@ -60,7 +64,7 @@ SharedMemory::SharedMemory(const Name_t& name,
     if (m_isInitialized)
     {
         m_name = name;
-        m_isInitialized = open(accessMode, openMode, permissions, size);
+        m_isInitialized = initializeHugePageFilePath() && open(accessMode, openMode, permissions, size);
     }
 
     if (!m_isInitialized)
@@ -68,8 +72,8 @@ SharedMemory::SharedMemory(const Name_t& name,
         std::cerr << "Unable to create shared memory with the following properties [ name = " << name
                   << ", access mode = " << ACCESS_MODE_STRING[static_cast<uint64_t>(accessMode)]
                   << ", open mode = " << OPEN_MODE_STRING[static_cast<uint64_t>(openMode)]
-                  << ", mode = " << std::bitset<sizeof(mode_t)>(permissions) << ", sizeInBytes = " << size << " ]"
-                  << std::endl;
+                  << ", mode = " << std::bitset<sizeof(mode_t)>(permissions) << ", sizeInBytes = " << size
+                  << ", hugePageSize = " << hugePageSize << " ]" << std::endl;
         return;
     }
 }
@@ -103,6 +107,8 @@ void SharedMemory::reset() noexcept
     m_hasOwnership = false;
     m_name = Name_t();
     m_handle = INVALID_HANDLE;
+    m_hugePageSize = NO_HUGE_PAGES;
+    m_hugePageFilePath = HugePageFilePath_t();
 }
 
 SharedMemory::SharedMemory(SharedMemory&& rhs) noexcept
@@ -121,6 +127,8 @@ SharedMemory& SharedMemory::operator=(SharedMemory&& rhs) noexcept
         m_name = rhs.m_name;
         m_hasOwnership = std::move(rhs.m_hasOwnership);
         m_handle = std::move(rhs.m_handle);
+        m_hugePageSize = rhs.m_hugePageSize;
+        m_hugePageFilePath = rhs.m_hugePageFilePath;
 
         rhs.reset();
     }
@@ -137,6 +145,36 @@ bool SharedMemory::hasOwnership() const noexcept
     return m_hasOwnership;
 }
 
+uint64_t SharedMemory::getHugePageSize() const noexcept
+{
+    return m_hugePageSize;
+}
+
+bool SharedMemory::initializeHugePageFilePath() noexcept
+{
+    if (m_hugePageSize == NO_HUGE_PAGES)
+    {
+        return true;
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) required by the platform function
+    char mountPoint[platform::IOX_MAX_PATH_LENGTH + 1U];
+    if (posixCall(iox_hugetlbfs_mount_point)(m_hugePageSize, mountPoint, platform::IOX_MAX_PATH_LENGTH + 1U)
+            .failureReturnValue(INVALID_HANDLE)
+            .suppressErrorMessagesForErrnos(ENOENT)
+            .evaluate()
+            .has_error())
+    {
+        m_errorValue = SharedMemoryError::NO_HUGE_PAGE_FILESYSTEM;
+        return false;
+    }
+
+    // the name has a leading slash and is therefore appended as file to the mount point
+    m_hugePageFilePath = HugePageFilePath_t(cxx::TruncateToCapacity, mountPoint);
+    m_hugePageFilePath.append(cxx::TruncateToCapacity, m_name);
+    return true;
+}
+
 // NOLINTNEXTLINE(readability-function-size) todo(iox-#832): make a struct out of arguments
 bool SharedMemory::open(const AccessMode accessMode,
                         const OpenMode openMode,
@@ -147,6 +185,13 @@ bool SharedMemory::open(const AccessMode accessMode,
 
     m_hasOwnership = (openMode == OpenMode::EXCLUSIVE_CREATE || openMode == OpenMode::PURGE_AND_CREATE
                       || openMode == OpenMode::OPEN_OR_CREATE);
+
+    // a shared memory backed by huge pages is a file in the hugetlbfs
+    const bool hasHugePages = (m_hugePageSize != NO_HUGE_PAGES);
+    auto openFunction = hasHugePages ? iox_open : iox_shm_open;
+    auto unlinkFunction = hasHugePages ? ::unlink : iox_shm_unlink;
+    const char* fileName = hasHugePages ? m_hugePageFilePath.c_str() : m_name.c_str();
+
     // the mask will be applied to the permissions, therefore we need to set it to 0
     mode_t umaskSaved = umask(0U);
     {
@@ -154,14 +199,19 @@ bool SharedMemory::open(const AccessMode accessMode,
 
         if (openMode == OpenMode::PURGE_AND_CREATE)
         {
-            IOX_DISCARD_RESULT(posixCall(iox_shm_unlink)(m_name.c_str())
+            IOX_DISCARD_RESULT(posixCall(unlinkFunction)(fileName)
                                    .failureReturnValue(INVALID_HANDLE)
                                    .ignoreErrnos(ENOENT)
                                    .evaluate());
+            if (hasHugePages)
+            {
+                // a previous run might have created the shared memory with the default page size
+                IOX_DISCARD_RESULT(unlinkIfExist(m_name));
+            }
         }
 
-        auto result = posixCall(iox_shm_open)(
-                          m_name.c_str(),
+        auto result = posixCall(openFunction)(
+                          fileName,
                           getOflagsFor(accessMode,
                                        (openMode == OpenMode::OPEN_OR_CREATE) ? OpenMode::EXCLUSIVE_CREATE : openMode),
                           permissions)
@@ -175,8 +225,8 @@ bool SharedMemory::open(const AccessMode accessMode,
             if (openMode == OpenMode::OPEN_OR_CREATE && result.get_error().errnum == EEXIST)
             {
                 m_hasOwnership = false;
-                result = posixCall(iox_shm_open)(
-                             m_name.c_str(), getOflagsFor(accessMode, OpenMode::OPEN_EXISTING), permissions)
+                result = posixCall(openFunction)(
+                             fileName, getOflagsFor(accessMode, OpenMode::OPEN_EXISTING), permissions)
                              .failureReturnValue(INVALID_HANDLE)
                              .evaluate();
                 if (!result.has_error())
@@ -208,9 +258,15 @@ bool SharedMemory::open(const AccessMode accessMode,
 }
 
 cxx::expected<bool, SharedMemoryError> SharedMemory::unlinkIfExist(const Name_t& name) noexcept
+{
+    return unlinkFileIfExist(iox_shm_unlink, name.c_str());
+}
+
+cxx::expected<bool, SharedMemoryError> SharedMemory::unlinkFileIfExist(int (*unlinkFunction)(const char*),
+                                                                       const char* fileName) noexcept
 {
     auto result =
-        posixCall(iox_shm_unlink)(name.c_str()).failureReturnValue(INVALID_HANDLE).ignoreErrnos(ENOENT).evaluate();
+        posixCall(unlinkFunction)(fileName).failureReturnValue(INVALID_HANDLE).ignoreErrnos(ENOENT).evaluate();
 
     if (!result.has_error())
     {
@@ -224,10 +280,11 @@ bool SharedMemory::unlink() noexcept
 {
     if (m_isInitialized && m_hasOwnership)
     {
-        auto unlinkResult = unlinkIfExist(m_name);
+        auto unlinkResult = (m_hugePageSize == NO_HUGE_PAGES) ? unlinkIfExist(m_name)
+                                                              : unlinkFileIfExist(::unlink, m_hugePageFilePath.c_str());
         if (unlinkResult.has_error() || !unlinkResult.value())
         {
-            std::cerr << "Unable to unlink SharedMemory (shm_unlink failed)." << std::endl;
+            std::cerr << "Unable to unlink SharedMemory (shm_unlink or unlink failed)." << std::endl;
             return false;
         }
     }
@@ -129,6 +129,11 @@ void BaseRelativePointer::unregisterAll() noexcept
     getRepository().unregisterAll();
 }
 
+void BaseRelativePointer::setUnknownIdHandler(const PointerRepository<id_t, ptr_t>::UnknownIdHandler handler) noexcept
+{
+    getRepository().setUnknownIdHandler(handler);
+}
+
 BaseRelativePointer::offset_t BaseRelativePointer::getOffset(const id_t id, const_ptr_t ptr) noexcept
 {
     if (id == NULL_POINTER_ID)
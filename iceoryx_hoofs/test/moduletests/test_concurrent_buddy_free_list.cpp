@@ -0,0 +1,188 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/buddy_free_list.hpp"
+#include "test.hpp"
+
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::concurrent::BuddyFreeList;
+
+class BuddyFreeList_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_TOP_BLOCKS{3U};
+    static constexpr uint32_t NUMBER_OF_ORDERS{5U};
+    static constexpr uint32_t NUMBER_OF_SMALLEST_BLOCKS{NUMBER_OF_TOP_BLOCKS << (NUMBER_OF_ORDERS - 1U)};
+
+    void SetUp() override
+    {
+        m_memory.resize(BuddyFreeList::requiredMemorySize(NUMBER_OF_TOP_BLOCKS, NUMBER_OF_ORDERS) / sizeof(uint64_t)
+                        + 1U);
+        m_sut.init(m_memory.data(), NUMBER_OF_TOP_BLOCKS, NUMBER_OF_ORDERS);
+    }
+
+    std::vector<uint64_t> m_memory;
+    BuddyFreeList m_sut;
+};
+
+constexpr uint32_t BuddyFreeList_test::NUMBER_OF_TOP_BLOCKS;
+constexpr uint32_t BuddyFreeList_test::NUMBER_OF_ORDERS;
+constexpr uint32_t BuddyFreeList_test::NUMBER_OF_SMALLEST_BLOCKS;
+
+TEST_F(BuddyFreeList_test, AllTopBlocksCanBePopped)
+{
+    BuddyFreeList::Index_t index{0U};
+    for (uint32_t i = 0U; i < NUMBER_OF_TOP_BLOCKS; ++i)
+    {
+        ASSERT_TRUE(m_sut.pop(NUMBER_OF_ORDERS - 1U, index));
+        EXPECT_THAT(index, Eq(i << (NUMBER_OF_ORDERS - 1U)));
+    }
+    EXPECT_FALSE(m_sut.pop(NUMBER_OF_ORDERS - 1U, index));
+    EXPECT_FALSE(m_sut.pop(0U, index));
+}
+
+TEST_F(BuddyFreeList_test, AllSmallestBlocksCanBePoppedBySplittingTheTopBlocks)
+{
+    std::vector<bool> isPopped(NUMBER_OF_SMALLEST_BLOCKS, false);
+    BuddyFreeList::Index_t index{0U};
+    for (uint32_t i = 0U; i < NUMBER_OF_SMALLEST_BLOCKS; ++i)
+    {
+        ASSERT_TRUE(m_sut.pop(0U, index));
+        ASSERT_THAT(index, Lt(NUMBER_OF_SMALLEST_BLOCKS));
+        EXPECT_FALSE(isPopped[index]);
+        isPopped[index] = true;
+    }
+    EXPECT_FALSE(m_sut.pop(0U, index));
+}
+
+TEST_F(BuddyFreeList_test, PopWithInvalidOrderFails)
+{
+    BuddyFreeList::Index_t index{0U};
+    EXPECT_FALSE(m_sut.pop(NUMBER_OF_ORDERS, index));
+}
+
+TEST_F(BuddyFreeList_test, OrderOfPoppedBlockIsStored)
+{
+    BuddyFreeList::Index_t index{0U};
+    ASSERT_TRUE(m_sut.pop(2U, index));
+    EXPECT_THAT(m_sut.orderOf(index), Eq(2U));
+    ASSERT_TRUE(m_sut.push(index));
+    EXPECT_THAT(m_sut.orderOf(index), Eq(NUMBER_OF_ORDERS));
+}
+
+TEST_F(BuddyFreeList_test, PushedBuddiesAreCoalescedToTopBlocks)
+{
+    std::vector<BuddyFreeList::Index_t> indices;
+    BuddyFreeList::Index_t index{0U};
+    while (m_sut.pop(0U, index))
+    {
+        indices.push_back(index);
+    }
+    ASSERT_THAT(indices.size(), Eq(NUMBER_OF_SMALLEST_BLOCKS));
+
+    for (auto i : indices)
+    {
+        ASSERT_TRUE(m_sut.push(i));
+    }
+
+    for (uint32_t i = 0U; i < NUMBER_OF_TOP_BLOCKS; ++i)
+    {
+        EXPECT_TRUE(m_sut.pop(NUMBER_OF_ORDERS - 1U, index));
+    }
+}
+
+TEST_F(BuddyFreeList_test, BlocksOfDifferentOrdersDoNotOverlap)
+{
+    std::vector<bool> isPopped(NUMBER_OF_SMALLEST_BLOCKS, false);
+    BuddyFreeList::Index_t index{0U};
+    uint32_t numberOfPoppedSmallestBlocks{0U};
+    for (uint32_t order = 0U; m_sut.pop(order, index); order = (order + 1U) % NUMBER_OF_ORDERS)
+    {
+        for (uint32_t i = index; i < index + (1U << order); ++i)
+        {
+            ASSERT_THAT(i, Lt(NUMBER_OF_SMALLEST_BLOCKS));
+            EXPECT_FALSE(isPopped[i]);
+            isPopped[i] = true;
+            ++numberOfPoppedSmallestBlocks;
+        }
+    }
+    EXPECT_THAT(numberOfPoppedSmallestBlocks, Gt(0U));
+}
+
+TEST_F(BuddyFreeList_test, DoublePushFails)
+{
+    BuddyFreeList::Index_t index{0U};
+    ASSERT_TRUE(m_sut.pop(1U, index));
+    EXPECT_TRUE(m_sut.push(index));
+    EXPECT_FALSE(m_sut.push(index));
+}
+
+TEST_F(BuddyFreeList_test, PushOfIndexWhichWasNotPoppedFails)
+{
+    BuddyFreeList::Index_t index{0U};
+    ASSERT_TRUE(m_sut.pop(2U, index));
+    EXPECT_FALSE(m_sut.push(index + 1U));
+    EXPECT_FALSE(m_sut.push(NUMBER_OF_SMALLEST_BLOCKS));
+}
+
+TEST_F(BuddyFreeList_test, ConcurrentPopAndPushCoalescesAllBlocks)
+{
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    constexpr uint32_t NUMBER_OF_ITERATIONS{20000U};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&, t] {
+            std::mt19937 generator(t);
+            std::uniform_int_distribution<uint32_t> orderDistribution(0U, NUMBER_OF_ORDERS - 2U);
+            std::vector<BuddyFreeList::Index_t> indices;
+            for (uint32_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+            {
+                BuddyFreeList::Index_t index{0U};
+                if (indices.size() < 4U && m_sut.pop(orderDistribution(generator), index))
+                {
+                    indices.push_back(index);
+                }
+                else if (!indices.empty())
+                {
+                    EXPECT_TRUE(m_sut.push(indices.back()));
+                    indices.pop_back();
+                }
+            }
+            for (auto index : indices)
+            {
+                EXPECT_TRUE(m_sut.push(index));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    BuddyFreeList::Index_t index{0U};
+    for (uint32_t i = 0U; i < NUMBER_OF_TOP_BLOCKS; ++i)
+    {
+        EXPECT_TRUE(m_sut.pop(NUMBER_OF_ORDERS - 1U, index));
+    }
+}
+} // namespace
@@ -199,4 +199,101 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TYPED_TEST(LoFFLi_test, PopBatchAcquiresUpToMaxCount)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size - 1), Eq(Size - 1));
+    for (uint32_t i = 0; i < Size - 1; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size), Eq(1U));
+    EXPECT_THAT(indices[0], Eq(Size - 1));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchFromEmptyLoFFLiReturnsZero)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size), Eq(Size));
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchStoresAcquiredCount)
+{
+    uint32_t indices[Size];
+    uint32_t acquiredCount{Size + 1U};
+    this->m_loffli.popBatch(indices, Size - 1, acquiredCount);
+    EXPECT_THAT(acquiredCount, Eq(Size - 1));
+
+    this->m_loffli.popBatch(indices, Size, acquiredCount);
+    EXPECT_THAT(acquiredCount, Eq(1U));
+
+    this->m_loffli.popBatch(indices, Size, acquiredCount);
+    EXPECT_THAT(acquiredCount, Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, CompletePopBatchAllowsToPushBatchTheIndicesAgain)
+{
+    uint32_t indices[Size];
+    uint32_t acquiredCount{0U};
+    this->m_loffli.popBatch(indices, Size, acquiredCount);
+    ASSERT_THAT(acquiredCount, Eq(Size));
+
+    this->m_loffli.completePopBatch(indices, acquiredCount);
+
+    EXPECT_THAT(this->m_loffli.pushBatch(indices, acquiredCount), Eq(true));
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchMakesIndicesAvailableAgain)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popBatch(indices, Size), Eq(Size));
+
+    EXPECT_THAT(this->m_loffli.pushBatch(indices, Size), Eq(true));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index;
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+    std::sort(useListPoped.begin(), useListPoped.end());
+
+    EXPECT_THAT(useListPoped, Eq(std::vector<uint32_t>(indices, indices + Size)));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchWithSingleIndexWorksWithPop)
+{
+    uint32_t index;
+    ASSERT_THAT(this->m_loffli.pop(index), Eq(true));
+
+    EXPECT_THAT(this->m_loffli.pushBatch(&index, 1), Eq(true));
+    EXPECT_THAT(this->m_loffli.push(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchWithDuplicateIndexFailsAndPushesNothing)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popBatch(indices, 2), Eq(2U));
+
+    uint32_t duplicates[3]{indices[0], indices[1], indices[0]};
+    EXPECT_THAT(this->m_loffli.pushBatch(duplicates, 3), Eq(false));
+
+    EXPECT_THAT(this->m_loffli.push(indices[0]), Eq(true));
+    EXPECT_THAT(this->m_loffli.push(indices[1]), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchWithIndexNotAcquiredFails)
+{
+    uint32_t index;
+    ASSERT_THAT(this->m_loffli.pop(index), Eq(true));
+
+    uint32_t indices[2]{index, index + 1};
+    EXPECT_THAT(this->m_loffli.pushBatch(indices, 2), Eq(false));
+    EXPECT_THAT(this->m_loffli.push(index), Eq(true));
+}
 } // namespace
@@ -335,6 +335,55 @@ TYPED_TEST(base_relative_ptr_test, basePointerValid)
     EXPECT_EQ(basePtr1, rp1.getBasePtr(1));
 }
 
+void* onDemandSegment{nullptr};
+uint64_t unknownIdHandlerCalls{0U};
+
+void* registerOnDemandSegment(const BaseRelativePointer::id_t id)
+{
+    ++unknownIdHandlerCalls;
+    BaseRelativePointer::registerPtr(id, onDemandSegment, SHARED_MEMORY_SIZE);
+    return onDemandSegment;
+}
+
+TYPED_TEST(base_relative_ptr_test, unknownIdHandlerRegistersSegmentOnDemand)
+{
+    onDemandSegment = this->memoryPartition[1];
+    unknownIdHandlerCalls = 0U;
+    BaseRelativePointer::setUnknownIdHandler(registerOnDemandSegment);
+
+    auto offset = SHARED_MEMORY_SIZE / 2U;
+    RelativePointer<TypeParam> rp(offset, 2U);
+    EXPECT_EQ(rp.get(), reinterpret_cast<TypeParam*>(&this->memoryPartition[1][offset]));
+    EXPECT_EQ(rp.get(), reinterpret_cast<TypeParam*>(&this->memoryPartition[1][offset]));
+    EXPECT_EQ(unknownIdHandlerCalls, 1U);
+    EXPECT_EQ(BaseRelativePointer::searchId(&this->memoryPartition[1][offset]), 2U);
+
+    BaseRelativePointer::setUnknownIdHandler(nullptr);
+}
+
+TYPED_TEST(base_relative_ptr_test, unknownIdHandlerIsNotCalledForRegisteredSegments)
+{
+    onDemandSegment = this->memoryPartition[1];
+    unknownIdHandlerCalls = 0U;
+    BaseRelativePointer::registerPtr(1U, this->memoryPartition[0], SHARED_MEMORY_SIZE);
+    BaseRelativePointer::setUnknownIdHandler(registerOnDemandSegment);
+
+    EXPECT_EQ(BaseRelativePointer::getBasePtr(1U), this->memoryPartition[0]);
+    EXPECT_EQ(unknownIdHandlerCalls, 0U);
+
+    BaseRelativePointer::setUnknownIdHandler(nullptr);
+}
+
+TYPED_TEST(base_relative_ptr_test, removedUnknownIdHandlerIsNotCalled)
+{
+    unknownIdHandlerCalls = 0U;
+    BaseRelativePointer::setUnknownIdHandler(registerOnDemandSegment);
+    BaseRelativePointer::setUnknownIdHandler(nullptr);
+
+    EXPECT_EQ(BaseRelativePointer::getBasePtr(3U), nullptr);
+    EXPECT_EQ(unknownIdHandlerCalls, 0U);
+}
+
 TYPED_TEST(base_relative_ptr_test, assignmentOperator)
 {
     RelativePointer<TypeParam> rp1(this->memoryPartition[0], 1);
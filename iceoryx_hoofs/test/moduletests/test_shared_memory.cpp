@@ -101,6 +101,27 @@ TEST_F(SharedMemory_Test, CTorWithInvalidArguments)
     EXPECT_THAT(sut.has_error(), Eq(true));
 }
 
+TEST_F(SharedMemory_Test, CTorWithHugePageSizeWithoutMountedHugetlbfsFails)
+{
+    // no hugetlbfs with a page size of 1 TiB exists
+    constexpr uint64_t HUGE_PAGE_SIZE{1ULL << 40U};
+    auto sut = iox::posix::SharedMemory::create(SUT_SHM_NAME,
+                                                iox::posix::AccessMode::READ_WRITE,
+                                                iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                S_IRUSR | S_IWUSR,
+                                                HUGE_PAGE_SIZE,
+                                                HUGE_PAGE_SIZE);
+    ASSERT_TRUE(sut.has_error());
+    EXPECT_THAT(sut.get_error(), Eq(iox::posix::SharedMemoryError::NO_HUGE_PAGE_FILESYSTEM));
+}
+
+TEST_F(SharedMemory_Test, SharedMemoryWithoutHugePagesHasNoHugePageSize)
+{
+    auto sut = createSut(SUT_SHM_NAME, iox::posix::OpenMode::PURGE_AND_CREATE);
+    ASSERT_FALSE(sut.has_error());
+    EXPECT_THAT(sut->getHugePageSize(), Eq(iox::posix::SharedMemory::NO_HUGE_PAGES));
+}
+
 TEST_F(SharedMemory_Test, MoveCTorWithValidValues)
 {
     int handle;
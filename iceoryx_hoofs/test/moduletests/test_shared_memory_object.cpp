@@ -17,6 +17,7 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "test.hpp"
 
 namespace
@@ -177,4 +178,132 @@ TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryAndReadMultipleContents)
     EXPECT_THAT(*sutValue1, Eq(4557));
     EXPECT_THAT(*sutValue2, Eq(8912));
 }
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryObjectWithoutHugePagesHasDefaultPageSize)
+{
+    auto sut = iox::posix::SharedMemoryObject::create("/shmPageSize",
+                                                      128,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT);
+    ASSERT_FALSE(sut.has_error());
+    EXPECT_THAT(sut->getPageSize(), Eq(iox::posix::pageSize()));
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryObjectFallsBackToDefaultPageSizeWhenHugePagesAreUnavailable)
+{
+    // no hugetlbfs with a page size of 1 TiB exists
+    constexpr uint64_t HUGE_PAGE_SIZE{1ULL << 40U};
+    uint64_t memorySize = 128;
+    auto sut = iox::posix::SharedMemoryObject::create("/shmHugePages",
+                                                      memorySize,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      HUGE_PAGE_SIZE);
+    ASSERT_FALSE(sut.has_error());
+    EXPECT_THAT(sut->getPageSize(), Eq(iox::posix::pageSize()));
+    EXPECT_THAT(sut->getSizeInBytes(), Eq(memorySize));
+
+    int* value = static_cast<int*>(sut->allocate(sizeof(int), 1));
+    *value = 1337;
+    EXPECT_THAT(*value, Eq(1337));
+}
+
+TEST_F(SharedMemoryObject_Test, OpenExistingSharedMemoryDoesNotFallBackToDefaultPageSize)
+{
+    constexpr uint64_t HUGE_PAGE_SIZE{1ULL << 40U};
+    uint64_t memorySize = 128;
+    auto creator = iox::posix::SharedMemoryObject::create("/shmHugePagesOpenExisting",
+                                                          memorySize,
+                                                          iox::posix::AccessMode::READ_WRITE,
+                                                          iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                          iox::posix::SharedMemoryObject::NO_ADDRESS_HINT);
+    ASSERT_FALSE(creator.has_error());
+
+    // the default page shared memory with the same name must not be mistaken for a huge page one
+    auto sut = iox::posix::SharedMemoryObject::create("/shmHugePagesOpenExisting",
+                                                      memorySize,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OpenMode::OPEN_EXISTING,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      HUGE_PAGE_SIZE);
+    EXPECT_TRUE(sut.has_error());
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryObjectProvisionedByMultipleWorkerThreadsIsZeroed)
+{
+    uint64_t memorySize = 16U * iox::posix::pageSize() + 128U;
+    iox::posix::SharedMemoryProvisioning provisioning;
+    provisioning.m_prefaultMode = iox::posix::PrefaultMode::TOUCH_PAGES;
+    provisioning.m_numberOfWorkerThreads = 4U;
+    auto sut = iox::posix::SharedMemoryObject::create("/shmProvisioning",
+                                                      memorySize,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      iox::posix::SharedMemory::NO_HUGE_PAGES,
+                                                      provisioning);
+    ASSERT_FALSE(sut.has_error());
+
+    auto memory = static_cast<uint8_t*>(sut->allocate(memorySize, 1));
+    ASSERT_THAT(memory, Ne(nullptr));
+    for (uint64_t i = 0U; i < memorySize; ++i)
+    {
+        ASSERT_THAT(memory[i], Eq(0U));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryObjectWithSkippedZeroingAndPopulatedPagesIsZeroed)
+{
+    uint64_t memorySize = 4U * iox::posix::pageSize();
+    iox::posix::SharedMemoryProvisioning provisioning;
+    provisioning.m_prefaultMode = iox::posix::PrefaultMode::POPULATE;
+    provisioning.m_skipZeroing = true;
+    // more worker threads than pages are reduced to one thread per page
+    provisioning.m_numberOfWorkerThreads = iox::posix::SharedMemoryProvisioning::MAX_NUMBER_OF_WORKER_THREADS;
+    auto sut = iox::posix::SharedMemoryObject::create("/shmProvisioning",
+                                                      memorySize,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      iox::posix::SharedMemory::NO_HUGE_PAGES,
+                                                      provisioning);
+    ASSERT_FALSE(sut.has_error());
+
+    auto memory = static_cast<uint8_t*>(sut->allocate(memorySize, 1));
+    ASSERT_THAT(memory, Ne(nullptr));
+    for (uint64_t i = 0U; i < memorySize; ++i)
+    {
+        ASSERT_THAT(memory[i], Eq(0U));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryObjectBoundToNumaNodeZeroResidesOnNodeZero)
+{
+    uint64_t memorySize = 4U * iox::posix::pageSize();
+    iox::posix::SharedMemoryProvisioning provisioning;
+    provisioning.m_prefaultMode = iox::posix::PrefaultMode::POPULATE;
+    provisioning.m_numaPolicy = iox::posix::NumaPolicy::BIND;
+    provisioning.m_numaNodeMask = 1U;
+    auto sut = iox::posix::SharedMemoryObject::create("/shmNuma",
+                                                      memorySize,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      iox::posix::SharedMemory::NO_HUGE_PAGES,
+                                                      provisioning);
+    ASSERT_FALSE(sut.has_error());
+
+#if defined(__linux__)
+    EXPECT_THAT(sut->getNumaNode(), Eq(0));
+#else
+    EXPECT_THAT(sut->getNumaNode(), Eq(iox::posix::SharedMemoryObject::UNKNOWN_NUMA_NODE));
+#endif
+}
 } // namespace
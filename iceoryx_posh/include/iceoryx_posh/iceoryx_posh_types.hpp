@@ -69,9 +69,10 @@ constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
 constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
+// 1x publisherPort mempool statistics introspection
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 6;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
 /// chunks a user is allowed to hold with the maximum queue capacity. This allows that a polling user can replace all
 /// the held chunks in one execution with all new ones from a completely filled queue. Or the other way round, when we
@@ -114,6 +115,13 @@ constexpr uint32_t MAX_APPLICATION_CAPRO_FIFO_SIZE = 128U;
 // Memory
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = 32U;
 constexpr uint32_t MAX_SHM_SEGMENTS = 100U;
+/// Maximum number of free chunk indices a port can cache per mempool, see MemPoolMagazine
+constexpr uint32_t MAX_CHUNK_MAGAZINE_CAPACITY = 8U;
+/// Number of bins of the histogram of requested chunk sizes which is collected for every mempool; the bins cover the
+/// chunk sizes of the four size classes below the chunk size of the mempool
+constexpr uint32_t NUMBER_OF_MEMPOOL_HISTOGRAM_BINS = 16U;
+/// Maximum number of ports with a chunk magazine, i.e. every port with a ChunkSender
+constexpr uint32_t MAX_NUMBER_OF_CHUNK_MAGAZINES = MAX_PUBLISHERS + MAX_CLIENTS + MAX_SERVERS;
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
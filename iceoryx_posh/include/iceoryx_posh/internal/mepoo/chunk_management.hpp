@@ -22,6 +22,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <limits>
 #include <utility>
 
 namespace iox
@@ -36,16 +37,30 @@ struct ChunkManagement
     using base_t = ChunkHeader;
     using referenceCounterBase_t = uint64_t;
     using referenceCounter_t = std::atomic<referenceCounterBase_t>;
+    /// @brief marks a chunk which was not added to the histogram of its mempool
+    static constexpr uint8_t NO_HISTOGRAM_BIN{std::numeric_limits<uint8_t>::max()};
 
     ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
                     const cxx::not_null<MemPool*> mempool,
                     const cxx::not_null<MemPool*> chunkManagementPool) noexcept;
 
+    /// @brief creates a ChunkManagement which is embedded in the chunk memory in front of the ChunkHeader; the
+    /// ChunkManagement is then the start of the chunk acquired from the mempool and there is no chunk management pool
+    ChunkManagement(const cxx::not_null<base_t*> chunkHeader, const cxx::not_null<MemPool*> mempool) noexcept;
+
+    /// @brief checks if the ChunkManagement is embedded in the chunk memory
+    /// @return true if the ChunkManagement was created without a chunk management pool, false otherwise
+    bool isEmbedded() const noexcept;
+
     iox::rp::RelativePointer<base_t> m_chunkHeader;
     referenceCounter_t m_referenceCounter{1U};
     /// @todo optimization: check if this can be replaced by an offset relative to the this pointer
     iox::rp::RelativePointer<MemPool> m_mempool;
     iox::rp::RelativePointer<MemPool> m_chunkManagementPool;
+    /// @brief the bytes of the chunk which are accounted as internal fragmentation of the mempool
+    uint32_t m_internalFragmentation{0U};
+    /// @brief the bin of the histogram of requested chunk sizes of the mempool to which the chunk was added
+    uint8_t m_histogramBin{NO_HISTOGRAM_BIN};
 };
 } // namespace mepoo
 } // namespace iox
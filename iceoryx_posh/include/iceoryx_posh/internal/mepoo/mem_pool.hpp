@@ -18,9 +18,13 @@
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/error_handling/error_handling.hpp"
+#include "iceoryx_hoofs/internal/concurrent/buddy_free_list.hpp"
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
 #include <atomic>
@@ -31,17 +35,51 @@ namespace iox
 {
 namespace mepoo
 {
+/// @brief a bin of the histogram of the chunk sizes which were requested from a mempool
+struct MemPoolHistogramBin
+{
+    /// @brief the number of chunks which were acquired for requests of this bin
+    uint64_t m_numberOfRequests{0U};
+    /// @brief the largest requested chunk size of this bin, i.e. ChunkSettings::requiredChunkSize
+    uint32_t m_maxRequestedChunkSize{0U};
+    /// @brief the maximum number of chunks of this bin which were in use at the same time
+    uint32_t m_peakUsedChunks{0U};
+};
+
 struct MemPoolInfo
 {
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint32_t chunkSize) noexcept;
+                const uint32_t chunkSize,
+                const uint32_t cachedChunks = 0U) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    /// @brief chunks which are cached in the magazines of the ports; they are neither used nor available to other
+    /// ports and are therefore not counted as free
+    uint32_t m_cachedChunks{0};
+    /// @brief the largest chunk size of a mempool with variable chunk sizes; the number of chunks are counted in
+    /// chunks of the smallest chunk size m_chunkSize. For a mempool with a single chunk size it is equal to m_chunkSize
+    uint32_t m_maxChunkSize{0};
+    /// @brief the number of bytes of the used chunks which are neither used by the ChunkHeader, the user-header nor
+    /// the user-payload, i.e. the memory which is wasted since the chunks are larger than requested
+    uint64_t m_internalFragmentation{0};
+    /// @brief the histogram of the requested chunk sizes, see MemPool::addToHistogram
+    MemPoolHistogramBin m_histogram[NUMBER_OF_MEMPOOL_HISTOGRAM_BINS];
+};
+
+/// @brief Cache of free chunk indices of a MemPool which is owned by a single port. It is refilled from and drained to
+/// the shared free list of the MemPool in batches to reduce the contention on the head of the free list
+struct MemPoolMagazine
+{
+    /// @brief set while the magazine is refilled; if the owner of the magazine terminates during the refill, the
+    /// indices which were already taken from the free list are still returned by MemPool::releaseMagazine
+    bool m_refillInProgress{false};
+    uint32_t m_numberOfIndices{0U};
+    concurrent::LoFFLi::Index_t m_indices[MAX_CHUNK_MAGAZINE_CAPACITY];
 };
 
 class MemPool
@@ -50,10 +88,17 @@ class MemPool
     using freeList_t = concurrent::LoFFLi;
     static constexpr uint64_t CHUNK_MEMORY_ALIGNMENT = 8U; // default alignment for 64 bit
 
+    /// @brief creates a mempool with numberOfChunks chunks of chunkSize
+    /// @param[in] magazineCapacity the number of chunks a port can cache, see getChunk(MemPoolMagazine&)
+    /// @param[in] numberOfChunkSizes if larger than 1, the chunks can be split into buddies of half the size down to
+    /// the smallest chunk size 'chunkSize / 2^(numberOfChunkSizes - 1)' which must be a multiple of
+    /// CHUNK_MEMORY_ALIGNMENT; freed buddies are coalesced again. Such a mempool does not support magazines
     MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
             const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
             posix::Allocator& managementAllocator,
-            posix::Allocator& chunkMemoryAllocator) noexcept;
+            posix::Allocator& chunkMemoryAllocator,
+            const uint32_t magazineCapacity = 0U,
+            const uint32_t numberOfChunkSizes = 1U) noexcept;
 
     MemPool(const MemPool&) = delete;
     MemPool(MemPool&&) = delete;
@@ -61,16 +106,102 @@ class MemPool
     MemPool& operator=(MemPool&&) = delete;
 
     void* getChunk() noexcept;
+
+    /// @brief acquires a chunk of the given chunk size; for a mempool with a single chunk size this is equivalent to
+    /// getChunk()
+    /// @param[in] chunkSize of the chunk, must be a chunk size returned by fittingChunkSize
+    /// @return pointer to the chunk or nullptr if the mempool has no free chunk of this size
+    void* getChunk(const uint32_t chunkSize) noexcept;
+
+    /// @brief calculates the smallest chunk size of the mempool which can hold requiredChunkSize
+    /// @param[in] requiredChunkSize is the size the chunk must provide
+    /// @return the fitting chunk size which is the largest chunk size if requiredChunkSize is too large
+    uint32_t fittingChunkSize(const uint32_t requiredChunkSize) const noexcept;
+
+    /// @brief acquires a chunk via the provided magazine; an empty magazine is refilled with up to
+    /// getMagazineCapacity() indices from the free list at once. If the magazine capacity is zero this is
+    /// equivalent to getChunk()
+    /// @param[in] magazine the magazine of the port which requests the chunk
+    /// @return pointer to the chunk or nullptr if the mempool is exhausted
+    void* getChunk(MemPoolMagazine& magazine) noexcept;
+
+    /// @brief returns all indices which are cached in the magazine to the free list at once
+    /// @param[in] magazine the magazine to drain
+    void releaseMagazine(MemPoolMagazine& magazine) noexcept;
+
+    /// @brief returns the largest chunk size of the mempool
     uint32_t getChunkSize() const noexcept;
+    /// @brief returns the smallest chunk size of the mempool which is equal to getChunkSize() unless the mempool has
+    /// multiple chunk sizes
+    uint32_t getMinChunkSize() const noexcept;
+    /// @brief returns the number of chunks with the largest chunk size
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
+    uint32_t getCachedChunks() const noexcept;
+    uint32_t getMagazineCapacity() const noexcept;
+    uint64_t getInternalFragmentation() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief accounts the bytes of an acquired chunk which are not used by the ChunkHeader, user-header and
+    /// user-payload as internal fragmentation
+    /// @param[in] unusedBytes of the chunk
+    void addInternalFragmentation(const uint32_t unusedBytes) noexcept;
+
+    /// @brief removes the bytes which were accounted with addInternalFragmentation when the chunk is freed
+    /// @param[in] unusedBytes of the chunk
+    void removeInternalFragmentation(const uint32_t unusedBytes) noexcept;
+
+    /// @brief adds an acquired chunk to the histogram of the requested chunk sizes; the requests are only counted
+    /// and the peak of the used chunks of the bin is updated with relaxed atomics in order to keep the overhead low
+    /// @param[in] bin of the histogram, must be smaller than NUMBER_OF_MEMPOOL_HISTOGRAM_BINS
+    /// @param[in] requiredChunkSize which was requested for the chunk
+    void addToHistogram(const uint32_t bin, const uint32_t requiredChunkSize) noexcept;
+
+    /// @brief removes a chunk which was added with addToHistogram when the chunk is freed
+    /// @param[in] bin of the histogram which was passed to addToHistogram
+    void removeFromHistogram(const uint32_t bin) noexcept;
+
+    /// @brief registers the calling thread as waiter for a freed chunk; the free chunks must be checked again after
+    /// the registration and before waitForFreedChunk is called, otherwise a chunk which was freed in between is missed
+    void addWaiter() noexcept;
+
+    /// @brief unregisters a waiter which was registered with addWaiter
+    void removeWaiter() noexcept;
+
+    /// @brief blocks until a chunk is freed or the timeout elapsed; requires a previous call to addWaiter. Since a
+    /// freed chunk is not reserved for the woken up thread, another thread can acquire it in the meantime
+    /// @param[in] timeout is the maximum time to wait, units::Duration::max() waits without timeout
+    /// @return true if a chunk was freed, false if the timeout elapsed
+    bool waitForFreedChunk(const units::Duration& timeout) noexcept;
+
+    /// @brief wakes up all waiters, e.g. when an extension with further chunks was added
+    void notifyAllWaiters() noexcept;
+
+    /// @brief forwards the notifications about freed chunks to another mempool; this is used for the mempools of an
+    /// extension segment since the waiters wait at the corresponding mempool of the configured segment
+    /// @param[in] memPool whose waiters are notified when a chunk of this mempool is freed
+    void forwardNotificationsTo(MemPool& memPool) noexcept;
+
   private:
+    struct HistogramBin
+    {
+        std::atomic<uint64_t> m_numberOfRequests{0U};
+        std::atomic<uint32_t> m_maxRequestedChunkSize{0U};
+        std::atomic<uint32_t> m_usedChunks{0U};
+        std::atomic<uint32_t> m_peakUsedChunks{0U};
+    };
+
+    static void storeMax(std::atomic<uint32_t>& value, const uint32_t newValue) noexcept;
+    void notifyWaiter() noexcept;
+
     void adjustMinFree() noexcept;
+    void* acquireChunk(const uint32_t index) noexcept;
+    bool hasMultipleChunkSizes() const noexcept;
+    void freeBuddy(const void* chunk) noexcept;
+    uint32_t numberOfSmallestChunks() const noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
 
     rp::RelativePointer<uint8_t> m_rawMemory;
@@ -79,13 +210,30 @@ class MemPool
     /// needs to be 32 bit since loffli supports only 32 bit numbers
     /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
     uint32_t m_numberOfChunks{0U};
+    uint32_t m_magazineCapacity{0U};
+    uint32_t m_numberOfChunkSizes{1U};
 
     /// @todo: put this into one struct and in a separate class in concurrent.
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
+    std::atomic<uint32_t> m_cachedChunks{0U};
     /// @todo: end
+    std::atomic<uint64_t> m_internalFragmentation{0U};
+    HistogramBin m_histogram[NUMBER_OF_MEMPOOL_HISTOGRAM_BINS];
+
+    /// @brief number of threads which wait for a freed chunk; the semaphore is only posted if there is a waiter
+    std::atomic<uint32_t> m_numberOfWaiters{0U};
+    posix::Semaphore m_freedChunkSemaphore =
+        std::move(posix::Semaphore::create(posix::CreateUnnamedSharedMemorySemaphore, 0U)
+                      .or_else([](posix::SemaphoreError&) {
+                          errorHandler(Error::kMEPOO__MEMPOOL_FAILED_TO_CREATE_SEMAPHORE, nullptr, ErrorLevel::FATAL);
+                      })
+                      .value());
+    rp::RelativePointer<MemPool> m_notifiedMemPool;
 
     freeList_t m_freeIndices;
+    /// @brief only used by a mempool with multiple chunk sizes; the indices refer to chunks of the smallest size
+    concurrent::BuddyFreeList m_freeBuddies;
 };
 
 } // namespace mepoo
@@ -19,11 +19,14 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 
@@ -39,7 +42,12 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
+/// @brief Per-port magazines for all mempools of a MemoryManager, including the chunk management pool
+struct ChunkMagazine
+{
+    MemPoolMagazine m_memPoolMagazines[MAX_NUMBER_OF_MEMPOOLS];
+    MemPoolMagazine m_chunkManagementMagazine;
+};
 
 class MemoryManager
 {
@@ -59,6 +67,38 @@ class MemoryManager
 
     SharedChunk getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief acquires a chunk via the magazines of a port, see MemPool::getChunk(MemPoolMagazine&)
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] magazine of the port which requests the chunk
+    /// @return a SharedChunk which is invalid if no chunk could be acquired
+    SharedChunk getChunk(const ChunkSettings& chunkSettings, ChunkMagazine& magazine) noexcept;
+
+    /// @brief acquires a chunk via the magazines of a port and waits for a freed chunk if the fitting mempool and the
+    /// mempools of all extensions are exhausted; the exhaustion is not reported as error
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] magazine of the port which requests the chunk
+    /// @param[in] timeout is the maximum time to wait, units::Duration::max() waits without timeout
+    /// @return a SharedChunk which is invalid if no chunk could be acquired until the timeout elapsed
+    SharedChunk getChunk(const ChunkSettings& chunkSettings,
+                         ChunkMagazine& magazine,
+                         const units::Duration& timeout) noexcept;
+
+    /// @brief returns all chunks cached in the magazines of a port to the mempools; must be called when the port
+    /// is destroyed or its owner process died
+    /// @param[in] magazine to release
+    void releaseChunkMagazine(ChunkMagazine& magazine) noexcept;
+
+    /// @brief appends a MemoryManager with the same mempools to the chain of extensions; the chunks of the
+    /// extensions are only acquired when the mempools of this MemoryManager and of all previous extensions are
+    /// exhausted; threads which wait for a freed chunk are woken up
+    /// @param[in] extension is the MemoryManager of a payload segment which was added at runtime
+    /// @note is called by RouDi while the applications can concurrently acquire chunks
+    void addExtension(MemoryManager& extension) noexcept;
+
+    /// @brief returns the next MemoryManager in the chain of extensions
+    /// @return pointer to the next MemoryManager or nullptr if there is none
+    MemoryManager* getExtension() const noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
@@ -67,22 +107,122 @@ class MemoryManager
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
 
+    /// @brief size which is reserved in front of the ChunkHeader for the ChunkManagement with the
+    /// ChunkManagementLayout::EMBEDDED
+    static constexpr uint32_t EMBEDDED_CHUNK_MANAGEMENT_SIZE{
+        static_cast<uint32_t>(((sizeof(ChunkManagement) + MemPool::CHUNK_MEMORY_ALIGNMENT - 1U)
+                               / MemPool::CHUNK_MEMORY_ALIGNMENT)
+                              * MemPool::CHUNK_MEMORY_ALIGNMENT)};
+
   private:
     static uint32_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
+    static uint32_t chunkManagementPrefixSize(const ChunkManagementLayout layout) noexcept;
+
+    /// @brief calculates the chunk size of the mempool for a mempool config entry; if the entry has a min size, the
+    /// chunks can be split into buddies and the chunk size is rounded up to the smallest chunk size times a power of two
+    /// @param[in] entry of the mempool config
+    /// @param[in] prefixSize which is reserved in front of the ChunkHeader
+    /// @param[out] numberOfChunkSizes is the number of chunk sizes the chunks can be split into
+    /// @return the largest chunk size of the mempool including the ChunkHeader and the prefix
+    static uint64_t memPoolChunkSize(const MePooConfig::Entry& entry,
+                                     const uint32_t prefixSize,
+                                     uint32_t& numberOfChunkSizes) noexcept;
+
+    /// @brief accounts the bytes of a newly acquired chunk which are not used by the ChunkHeader, user-header and
+    /// user-payload as internal fragmentation of its mempool
+    static void addInternalFragmentation(ChunkManagement& chunkManagement) noexcept;
+
+    /// @brief calculates the bin of the histogram of requested chunk sizes of a mempool; the bin is the number of
+    /// size buckets between requiredChunkSize and the largest chunk size of the mempool, requests which are even
+    /// smaller are accounted in the last bin
+    /// @param[in] memPoolIndex of the mempool which provides the chunk
+    /// @param[in] requiredChunkSize of the request
+    /// @return the bin in the range [0, NUMBER_OF_MEMPOOL_HISTOGRAM_BINS)
+    uint32_t histogramBinOf(const uint32_t memPoolIndex, const uint32_t requiredChunkSize) const noexcept;
+
+    /// @brief adds a newly acquired chunk to the histogram of requested chunk sizes of its mempool
+    static void addToHistogram(ChunkManagement& chunkManagement,
+                               const uint32_t histogramBin,
+                               const uint32_t requiredChunkSize) noexcept;
+
+    /// @brief the chunk size of a mempool without the space reserved for an embedded ChunkManagement, i.e. the
+    /// size which is available for the ChunkHeader, user-header and user-payload
+    uint32_t availableChunkSize(const MemPool& memPool) const noexcept;
 
     void printMemPoolVector(log::LogStream& log) const noexcept;
+    SharedChunk getChunk(const ChunkSettings& chunkSettings, ChunkMagazine* const magazine) noexcept;
+
+    /// @brief acquires a chunk from the fitting mempool or one of the extensions without reporting the exhaustion
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] magazine of the port which requests the chunk or nullptr
+    /// @param[out] exhaustedMemPool is set to the fitting mempool if it and the mempools of all extensions are
+    /// exhausted, otherwise to nullptr
+    /// @return a SharedChunk which is invalid if no chunk could be acquired
+    SharedChunk acquireChunk(const ChunkSettings& chunkSettings,
+                             ChunkMagazine* const magazine,
+                             MemPool*& exhaustedMemPool) noexcept;
     void addMemPool(posix::Allocator& managementAllocator,
                     posix::Allocator& chunkMemoryAllocator,
                     const cxx::greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                    const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
+                    const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
+                    const uint32_t magazineCapacity,
+                    const uint32_t minChunkPayloadSize) noexcept;
     void generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept;
+    static uint32_t requiredNumberOfChunkManagementEntries(const uint32_t totalNumberOfChunks,
+                                                           const uint32_t maxMagazineCapacity) noexcept;
+
+    /// @brief calculates the size class of a chunk size, i.e. ceil(log2(chunkSize)); the size class 'c' contains
+    /// all chunk sizes in the range (2^(c-1), 2^c]
+    /// @param[in] chunkSize for which the size class shall be calculated
+    /// @return the size class in the range [0, NUMBER_OF_SIZE_CLASSES)
+    static uint32_t sizeClassOf(const uint32_t chunkSize) noexcept;
+
+    /// @brief calculates the size bucket of a chunk size; each size class is split into
+    /// NUMBER_OF_SUB_BUCKETS_PER_SIZE_CLASS equally sized buckets by the bits following the most significant bit
+    /// @param[in] chunkSize for which the size bucket shall be calculated
+    /// @return the size bucket in the range [0, NUMBER_OF_SIZE_BUCKETS)
+    static uint32_t sizeBucketOf(const uint32_t chunkSize) noexcept;
+
+    /// @brief calculates the smallest chunk size which belongs to a size bucket
+    static uint64_t smallestChunkSizeOfSizeBucket(const uint32_t sizeBucket) noexcept;
+
+    /// @brief fills the size class index with the first mempool which can hold the smallest chunk size of each
+    /// size bucket and stores the size bucket of the largest chunk size of each mempool for the histogram of
+    /// requested chunk sizes; must be called after all mempools are added
+    void generateSizeClassIndex() noexcept;
+
+    /// @brief looks up the first mempool with a chunk size of at least requiredChunkSize; the size class index
+    /// limits the search to the mempools within the size bucket of requiredChunkSize which are then bisected, i.e.
+    /// at most log2(MAX_NUMBER_OF_MEMPOOLS) mempools are compared
+    /// @param[in] requiredChunkSize is the chunk size the mempool must provide
+    /// @return the index of the mempool or the number of mempools if there is no fitting mempool
+    uint32_t findMemPoolIndex(const uint32_t requiredChunkSize) const noexcept;
 
   private:
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{33U};
+    static constexpr uint32_t SUB_BUCKET_BITS{2U};
+    static constexpr uint32_t NUMBER_OF_SUB_BUCKETS_PER_SIZE_CLASS{1U << SUB_BUCKET_BITS};
+    static constexpr uint32_t NUMBER_OF_SIZE_BUCKETS{NUMBER_OF_SIZE_CLASSES * NUMBER_OF_SUB_BUCKETS_PER_SIZE_CLASS};
+    static_assert(MAX_NUMBER_OF_MEMPOOLS <= std::numeric_limits<uint8_t>::max(),
+                  "The size class index uses uint8_t to store the mempool indices!");
+    static_assert(NUMBER_OF_SIZE_BUCKETS <= std::numeric_limits<uint8_t>::max(),
+                  "The size buckets of the mempools are stored as uint8_t!");
+    static_assert(NUMBER_OF_MEMPOOL_HISTOGRAM_BINS < ChunkManagement::NO_HISTOGRAM_BIN,
+                  "The histogram bin of a chunk is stored as uint8_t in the ChunkManagement!");
+
     bool m_denyAddMemPool{false};
+    ChunkManagementLayout m_chunkManagementLayout{ChunkManagementLayout::MEMPOOL};
+    uint32_t m_chunkManagementPrefixSize{0};
     uint32_t m_totalNumberOfChunks{0};
+    uint32_t m_maxMagazineCapacity{0};
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
+    uint8_t m_sizeClassIndex[NUMBER_OF_SIZE_BUCKETS]{};
+    uint8_t m_memPoolSizeBucket[MAX_NUMBER_OF_MEMPOOLS]{};
+
+    rp::RelativePointer<MemoryManager> m_extension;
+    std::atomic<bool> m_hasExtension{false};
 };
 
 } // namespace mepoo
@@ -37,7 +37,10 @@ class MePooSegment
                  posix::Allocator& managementAllocator,
                  const posix::PosixGroup& readerGroup,
                  const posix::PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const uint64_t hugePageSize = posix::SharedMemory::NO_HUGE_PAGES,
+                 const posix::SharedMemoryProvisioning& provisioning = posix::SharedMemoryProvisioning(),
+                 const uint32_t extensionIndex = 0U) noexcept;
 
     posix::PosixGroup getWriterGroup() const noexcept;
     posix::PosixGroup getReaderGroup() const noexcept;
@@ -46,9 +49,28 @@ class MePooSegment
 
     uint64_t getSegmentId() const noexcept;
 
+    /// @brief returns the index of the segment in the chain of payload segments which RouDi added at runtime to
+    /// the configured segment of the writer group
+    /// @return 0 for the configured segment, otherwise the index of the extension
+    uint32_t getExtensionIndex() const noexcept;
+
+    /// @brief returns the name of the shared memory of the segment
+    ShmName_t getSharedMemoryName() const noexcept;
+
+    /// @brief returns the name of the shared memory of a segment of a writer group
+    /// @param[in] writerGroup of the segment
+    /// @param[in] extensionIndex of the segment, 0 for the configured segment
+    /// @return "/<writer group>" for the configured segment and "/<writer group>_ext<extension index>" for extensions
+    static ShmName_t sharedMemoryName(const posix::PosixGroup& writerGroup,
+                                       const uint32_t extensionIndex) noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
-                                                    const posix::PosixGroup& writerGroup) noexcept;
+                                                    const posix::PosixGroup& readerGroup,
+                                                    const posix::PosixGroup& writerGroup,
+                                                    const uint64_t hugePageSize,
+                                                    const posix::SharedMemoryProvisioning& provisioning,
+                                                    const uint32_t extensionIndex) noexcept;
 
   protected:
     SharedMemoryObjectType m_sharedMemoryObject;
@@ -57,6 +79,7 @@ class MePooSegment
     posix::PosixGroup m_writerGroup;
     uint64_t m_segmentId;
     iox::mepoo::MemoryInfo m_memoryInfo;
+    uint32_t m_extensionIndex{0U};
 
   private:
     void setSegmentId(const uint64_t segmentId) noexcept;
@@ -17,7 +17,9 @@
 #ifndef IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 #define IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 
+#include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
@@ -33,13 +35,28 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     posix::Allocator& managementAllocator,
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
-    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const uint64_t hugePageSize,
+    const posix::SharedMemoryProvisioning& provisioning,
+    const uint32_t extensionIndex) noexcept
+    : m_sharedMemoryObject(std::move(createSharedMemoryObject(
+        mempoolConfig, readerGroup, writerGroup, hugePageSize, provisioning, extensionIndex)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
+    , m_extensionIndex(extensionIndex)
 {
     using namespace posix;
+    // with the embedded layout the reference counter is located in the payload segment; a reader has only read
+    // access to it and could not release a sample
+    if (mempoolConfig.m_chunkManagementLayout == ChunkManagementLayout::EMBEDDED && !(readerGroup == writerGroup))
+    {
+        LogError() << "The embedded chunk management requires the same reader and writer group but the segment has "
+                      "the reader group "
+                   << readerGroup.getName() << " and the writer group " << writerGroup.getName();
+        errorHandler(Error::kMEPOO__SEGMENT_EMBEDDED_CHUNK_MANAGEMENT_REQUIRES_SAME_READER_AND_WRITER_GROUP);
+    }
+
     AccessController accessController;
     if (!(readerGroup == writerGroup))
     {
@@ -54,7 +71,18 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
     if (!accessController.writePermissionsToFile(m_sharedMemoryObject.getFileHandle()))
     {
-        errorHandler(Error::kMEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+        // hugetlbfs does not support ACLs; the permission bits of the file are sufficient since huge pages are only
+        // used when the segment is accessed by the group of RouDi, see createSharedMemoryObject
+        const bool isBackedByHugePages = m_sharedMemoryObject.getPageSize() > posix::pageSize();
+        if (isBackedByHugePages)
+        {
+            LogWarn() << "Unable to apply the access control list to the huge page segment of group "
+                      << writerGroup.getName() << ", using the permission bits of the file instead";
+        }
+        else
+        {
+            errorHandler(Error::kMEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+        }
     }
 
     m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, *m_sharedMemoryObject.getAllocator());
@@ -63,29 +91,45 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const posix::PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const posix::PosixGroup& readerGroup,
+    const posix::PosixGroup& writerGroup,
+    const uint64_t hugePageSize,
+    const posix::SharedMemoryProvisioning& provisioning,
+    const uint32_t extensionIndex) noexcept
 {
     // we let the OS decide where to map the shm segments
     constexpr void* BASE_ADDRESS_HINT{nullptr};
 
-    // on qnx the current working directory will be added to the /dev/shmem path if the leading slash is missing
-    constexpr char SHARED_MEMORY_NAME_PREFIX[] = "/";
-    posix::SharedMemory::Name_t shmName = SHARED_MEMORY_NAME_PREFIX + writerGroup.getName();
+    // hugetlbfs does not support ACLs, therefore a segment for other groups than the one of RouDi must be created
+    // with shm_open
+    uint64_t segmentHugePageSize = hugePageSize;
+    const auto roudiGroup = posix::PosixGroup::getGroupOfCurrentProcess();
+    if (hugePageSize != posix::SharedMemory::NO_HUGE_PAGES && !(readerGroup == roudiGroup && writerGroup == roudiGroup))
+    {
+        LogWarn() << "The segment of the reader group " << readerGroup.getName() << " and the writer group "
+                  << writerGroup.getName() << " cannot be backed by huge pages since only the group of RouDi "
+                  << roudiGroup.getName() << " is supported, falling back to the default page size";
+        segmentHugePageSize = posix::SharedMemory::NO_HUGE_PAGES;
+    }
 
     return std::move(
-        SharedMemoryObjectType::create(shmName,
+        SharedMemoryObjectType::create(sharedMemoryName(writerGroup, extensionIndex),
                                        MemoryManager::requiredChunkMemorySize(mempoolConfig),
                                        posix::AccessMode::READ_WRITE,
                                        posix::OpenMode::PURGE_AND_CREATE,
                                        BASE_ADDRESS_HINT,
-                                       static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP))
+                                       static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP),
+                                       segmentHugePageSize,
+                                       provisioning)
             .and_then([this](auto& sharedMemoryObject) {
                 this->setSegmentId(iox::rp::BaseRelativePointer::registerPtr(sharedMemoryObject.getBaseAddress(),
                                                                              sharedMemoryObject.getSizeInBytes()));
 
                 LogDebug() << "Roudi registered payload data segment "
                            << iox::log::HexFormat(reinterpret_cast<uint64_t>(sharedMemoryObject.getBaseAddress()))
-                           << " with size " << sharedMemoryObject.getSizeInBytes() << " to id " << m_segmentId;
+                           << " with size " << sharedMemoryObject.getSizeInBytes() << " and page size "
+                           << sharedMemoryObject.getPageSize() << " to id " << m_segmentId;
             })
             .or_else([](auto&) { errorHandler(Error::kMEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT); })
             .value());
@@ -122,6 +166,36 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentId;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline uint32_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getExtensionIndex() const noexcept
+{
+    return m_extensionIndex;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline ShmName_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryName() const noexcept
+{
+    return sharedMemoryName(m_writerGroup, m_extensionIndex);
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline ShmName_t
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::sharedMemoryName(const posix::PosixGroup& writerGroup,
+                                                                         const uint32_t extensionIndex) noexcept
+{
+    // on qnx the current working directory will be added to the /dev/shmem path if the leading slash is missing
+    constexpr char SHARED_MEMORY_NAME_PREFIX[] = "/";
+    ShmName_t shmName = SHARED_MEMORY_NAME_PREFIX + writerGroup.getName();
+    if (extensionIndex > 0U)
+    {
+        // "_ext" and up to 10 digits
+        using ExtensionSuffix_t = cxx::string<16U>;
+        shmName.append(cxx::TruncateToCapacity,
+                       ExtensionSuffix_t(cxx::TruncateToCapacity, "_ext" + cxx::convert::toString(extensionIndex)));
+    }
+    return shmName;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::setSegmentId(const uint64_t segmentId) noexcept
 {
@@ -28,6 +28,8 @@
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
 #include "iceoryx_posh/mepoo/segment_config.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace roudi
@@ -59,12 +61,14 @@ class SegmentManager
                        uint64_t size,
                        bool isWritable,
                        uint64_t segmentId,
+                       uint64_t pageSize,
                        const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept
             : m_sharedMemoryName(sharedMemoryName)
             , m_startAddress(startAddress)
             , m_size(size)
             , m_isWritable(isWritable)
             , m_segmentId(segmentId)
+            , m_pageSize(pageSize)
             , m_memoryInfo(memoryInfo)
 
         {
@@ -75,6 +79,7 @@ class SegmentManager
         uint64_t m_size{0};
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
+        uint64_t m_pageSize{0}; // the size of the pages which back the segment, larger than default for huge pages
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
     };
 
@@ -89,12 +94,46 @@ class SegmentManager
     SegmentMappingContainer getSegmentMappings(const posix::PosixUser& user) noexcept;
     SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept;
 
+    /// @brief adds a payload segment with the same mempools to every segment with a SegmentGrowth policy whose
+    /// mempools exceed the high-water mark; the applications map the new segment on demand when they access it for
+    /// the first time
+    /// @note is called cyclically by RouDi; must not be called concurrently
+    void extendSegmentsAboveHighWaterMark() noexcept;
+
+    /// @brief the management memory includes the memory for the max number of extensions of each segment
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
+    /// @brief the chunk memory of the extensions is not included since it is allocated when they are added
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
 
   private:
+    /// @brief a configured segment with a SegmentGrowth policy
+    struct GrowableSegment
+    {
+        GrowableSegment(const SegmentConfig::SegmentEntry& segmentEntry,
+                        const uint64_t segmentIndex,
+                        void* const managementMemory) noexcept
+            : m_segmentEntry(segmentEntry)
+            , m_segmentIndex(segmentIndex)
+            , m_managementMemory(managementMemory)
+        {
+        }
+
+        SegmentConfig::SegmentEntry m_segmentEntry;
+        uint64_t m_segmentIndex{0U};
+        uint32_t m_numberOfExtensions{0U};
+        /// @brief the management memory for all extensions which is reserved at startup
+        void* m_managementMemory{nullptr};
+    };
+
     void createSegment(const SegmentConfig::SegmentEntry& segmentEntry) noexcept;
+    bool isAboveHighWaterMark(const GrowableSegment& growableSegment) noexcept;
+    void addExtension(GrowableSegment& growableSegment) noexcept;
+
+    /// @brief the number of segments which are completely constructed; segments can be added at runtime, therefore
+    /// the segments must only be accessed up to this number and not by iterating over the segment container
+    uint64_t numberOfSegments() const noexcept;
+    SegmentType& segmentAt(const uint64_t index) noexcept;
 
   private:
     template <typename MemoryManger, typename SegmentManager, typename PublisherPort>
@@ -102,6 +141,8 @@ class SegmentManager
 
     posix::Allocator* m_managementAllocator;
     cxx::vector<SegmentType, MAX_SHM_SEGMENTS> m_segmentContainer;
+    std::atomic<uint64_t> m_numberOfSegments{0U};
+    cxx::vector<GrowableSegment, MAX_SHM_SEGMENTS> m_growableSegments;
     bool m_createInterfaceEnabled{true};
 };
 
@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 
 namespace iox
 {
@@ -43,8 +44,116 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
 {
     auto readerGroup = iox::posix::PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = iox::posix::PosixGroup(segmentEntry.m_writerGroup);
-    m_segmentContainer.emplace_back(
-        segmentEntry.m_mempoolConfig, *m_managementAllocator, readerGroup, writerGroup, segmentEntry.m_memoryInfo);
+    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+                                    *m_managementAllocator,
+                                    readerGroup,
+                                    writerGroup,
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_hugePageSize,
+                                    segmentEntry.m_provisioning);
+    m_numberOfSegments.store(m_segmentContainer.size(), std::memory_order_release);
+
+    if (segmentEntry.m_growth.m_maxExtensions > 0U)
+    {
+        // the management memory is located in the management segment which cannot grow, therefore it is reserved
+        // for all extensions at startup; the chunk memory is only allocated when an extension is added
+        const uint64_t managementMemorySize =
+            MemoryManager::requiredManagementMemorySize(segmentEntry.m_mempoolConfig)
+            * segmentEntry.m_growth.m_maxExtensions;
+        auto managementMemory = m_managementAllocator->allocate(managementMemorySize, MemPool::CHUNK_MEMORY_ALIGNMENT);
+        m_growableSegments.emplace_back(segmentEntry, m_segmentContainer.size() - 1U, managementMemory);
+    }
+}
+
+template <typename SegmentType>
+inline uint64_t SegmentManager<SegmentType>::numberOfSegments() const noexcept
+{
+    return m_numberOfSegments.load(std::memory_order_acquire);
+}
+
+template <typename SegmentType>
+inline SegmentType& SegmentManager<SegmentType>::segmentAt(const uint64_t index) noexcept
+{
+    // the size of the segment container is not used since it is already incremented while a segment is constructed
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by numberOfSegments()
+    return m_segmentContainer.data()[index];
+}
+
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::extendSegmentsAboveHighWaterMark() noexcept
+{
+    for (auto& growableSegment : m_growableSegments)
+    {
+        if (growableSegment.m_numberOfExtensions < growableSegment.m_segmentEntry.m_growth.m_maxExtensions
+            && isAboveHighWaterMark(growableSegment))
+        {
+            addExtension(growableSegment);
+        }
+    }
+}
+
+template <typename SegmentType>
+inline bool SegmentManager<SegmentType>::isAboveHighWaterMark(const GrowableSegment& growableSegment) noexcept
+{
+    const uint64_t highWaterMark = growableSegment.m_segmentEntry.m_growth.m_highWaterMark;
+    auto& memoryManager = segmentAt(growableSegment.m_segmentIndex).getMemoryManager();
+    for (uint32_t i = 0U; i < memoryManager.getNumberOfMemPools(); ++i)
+    {
+        // all extensions have the same mempools, therefore the usage of a mempool is the usage of all of its copies
+        uint64_t usedChunks{0U};
+        uint64_t numberOfChunks{0U};
+        for (const MemoryManager* extension = &memoryManager; extension != nullptr;
+             extension = extension->getExtension())
+        {
+            const auto memPoolInfo = extension->getMemPoolInfo(i);
+            usedChunks += memPoolInfo.m_usedChunks;
+            numberOfChunks += memPoolInfo.m_numChunks;
+        }
+
+        if (usedChunks * 100U >= numberOfChunks * highWaterMark)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::addExtension(GrowableSegment& growableSegment) noexcept
+{
+    const auto& segmentEntry = growableSegment.m_segmentEntry;
+    if (m_segmentContainer.size() >= m_segmentContainer.capacity())
+    {
+        LogWarn() << "Unable to extend the segment of the writer group " << segmentEntry.m_writerGroup
+                  << " since the maximum number of " << MAX_SHM_SEGMENTS << " segments is reached";
+        growableSegment.m_numberOfExtensions = segmentEntry.m_growth.m_maxExtensions;
+        return;
+    }
+
+    const uint64_t managementMemorySize = MemoryManager::requiredManagementMemorySize(segmentEntry.m_mempoolConfig);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the memory is reserved for all extensions
+    posix::Allocator managementAllocator(static_cast<uint8_t*>(growableSegment.m_managementMemory)
+                                             + growableSegment.m_numberOfExtensions * managementMemorySize,
+                                         managementMemorySize);
+    ++growableSegment.m_numberOfExtensions;
+
+    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+                                    managementAllocator,
+                                    iox::posix::PosixGroup(segmentEntry.m_readerGroup),
+                                    iox::posix::PosixGroup(segmentEntry.m_writerGroup),
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_hugePageSize,
+                                    segmentEntry.m_provisioning,
+                                    growableSegment.m_numberOfExtensions);
+    auto& extension = m_segmentContainer.back();
+
+    // the segment must be visible for the on demand mapping before the applications can acquire chunks from it
+    m_numberOfSegments.store(m_segmentContainer.size(), std::memory_order_release);
+    segmentAt(growableSegment.m_segmentIndex).getMemoryManager().addExtension(extension.getMemoryManager());
+
+    LogInfo() << "Extended the segment of the writer group " << segmentEntry.m_writerGroup << " with the segment "
+              << extension.getSharedMemoryName() << " (" << growableSegment.m_numberOfExtensions << " of "
+              << segmentEntry.m_growth.m_maxExtensions << ")";
 }
 
 template <typename SegmentType>
@@ -57,22 +166,27 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
     SegmentManager::SegmentMappingContainer mappingContainer;
     bool foundInWriterGroup = false;
 
+    const uint64_t numberOfSegments = this->numberOfSegments();
+
     // with the groups we can get all the segments (read or write) for the user
     for (const auto& groupID : groupContainer)
     {
-        for (const auto& segment : m_segmentContainer)
+        for (uint64_t i = 0U; i < numberOfSegments; ++i)
         {
+            const auto& segment = segmentAt(i);
             if (segment.getWriterGroup() == groupID)
             {
                 // a user is allowed to be only in one writer group, as we currently only support one memory manager per
-                // process
-                if (!foundInWriterGroup)
+                // process; the extensions of a segment belong to the memory manager of the segment
+                const bool isExtension = segment.getExtensionIndex() > 0U;
+                if (!foundInWriterGroup || isExtension)
                 {
-                    mappingContainer.emplace_back("/" + segment.getWriterGroup().getName(),
+                    mappingContainer.emplace_back(segment.getSharedMemoryName(),
                                                   segment.getSharedMemoryObject().getBaseAddress(),
                                                   segment.getSharedMemoryObject().getSizeInBytes(),
                                                   true,
-                                                  segment.getSegmentId());
+                                                  segment.getSegmentId(),
+                                                  segment.getSharedMemoryObject().getPageSize());
                     foundInWriterGroup = true;
                 }
                 else
@@ -85,19 +199,21 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
 
     for (const auto& groupID : groupContainer)
     {
-        for (const auto& segment : m_segmentContainer)
+        for (uint64_t i = 0U; i < numberOfSegments; ++i)
         {
+            const auto& segment = segmentAt(i);
             // only add segments which are not yet added as writer
             if (segment.getReaderGroup() == groupID
                 && std::find_if(mappingContainer.begin(), mappingContainer.end(), [&](const SegmentMapping& mapping) {
                        return mapping.m_startAddress == segment.getSharedMemoryObject().getBaseAddress();
                    }) == mappingContainer.end())
             {
-                mappingContainer.emplace_back("/" + segment.getWriterGroup().getName(),
+                mappingContainer.emplace_back(segment.getSharedMemoryName(),
                                               segment.getSharedMemoryObject().getBaseAddress(),
                                               segment.getSharedMemoryObject().getSizeInBytes(),
                                               false,
-                                              segment.getSegmentId());
+                                              segment.getSegmentId(),
+                                              segment.getSharedMemoryObject().getPageSize());
             }
         }
     }
@@ -114,11 +230,14 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const p
     SegmentUserInformation segmentInfo{cxx::nullopt_t(), 0u};
 
     // with the groups we can search for the writable segment of this user
+    const uint64_t numberOfSegments = this->numberOfSegments();
     for (const auto& groupID : groupContainer)
     {
-        for (auto& segment : m_segmentContainer)
+        for (uint64_t i = 0U; i < numberOfSegments; ++i)
         {
-            if (segment.getWriterGroup() == groupID)
+            auto& segment = segmentAt(i);
+            // the extensions are chained to the memory manager of the configured segment
+            if (segment.getWriterGroup() == groupID && segment.getExtensionIndex() == 0U)
             {
                 segmentInfo.m_memoryManager = segment.getMemoryManager();
                 segmentInfo.m_segmentID = segment.getSegmentId();
@@ -136,7 +255,8 @@ uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const Segment
     uint64_t memorySize{0u};
     for (auto segment : config.m_sharedMemorySegments)
     {
-        memorySize += MemoryManager::requiredManagementMemorySize(segment.m_mempoolConfig);
+        memorySize += MemoryManager::requiredManagementMemorySize(segment.m_mempoolConfig)
+                      * (1U + static_cast<uint64_t>(segment.m_growth.m_maxExtensions));
     }
     return memorySize;
 }
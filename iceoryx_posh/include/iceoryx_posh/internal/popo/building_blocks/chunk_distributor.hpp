@@ -18,6 +18,10 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/platform/signal.hpp"
+#include "iceoryx_hoofs/platform/types.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
@@ -47,12 +51,15 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
+/// The stored queues are double buffered. Adding and removing queues is serialized by the LockingPolicy and modifies
+/// the inactive snapshot which is then swapped with the active one. Delivering chunks only registers as reader of the
+/// active snapshot and does not take the lock, therefore sending never blocks on RouDi. A snapshot is never modified
+/// while it has readers and removing a queue returns only after the readers of the previous snapshot left it. The
+/// process id of the sender is stored with the reader counts, therefore the reader counts of a sender which was
+/// terminated while delivering are released as soon as a queue modification detects that the process is gone.
 /// @todo There are currently some challenge:
-/// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
-/// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
-/// threads is in the ChunkDistributor and holds a lock. An easier setup would be if changing the queues
-/// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
-/// access to the containers. Then a memory synchronization would be sufficient.
+/// The history is still protected by an inter-process mutex. This can lead to deadlocks if a user process with a
+/// history gets terminated while one of its threads updates the history and holds the lock.
 /// The cleanup() call is the biggest challenge. This is used to free chunks that are still held by a not properly
 /// terminated user application. Even if access from middleware and user threads do not overlap, the history
 /// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
@@ -131,7 +138,21 @@ class ChunkDistributor
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief Registers as reader of the active queue snapshot
+    /// @return the index of the snapshot which must be passed to releaseQueueSnapshot
+    uint64_t acquireQueueSnapshot() const noexcept;
+    void releaseQueueSnapshot(const uint64_t snapshot) const noexcept;
+
+    /// @brief Copies the active queue snapshot to the inactive one once it has no readers. Must be called with the lock
+    /// @return the inactive snapshot to modify
+    typename MemberType_t::QueueContainer_t& prepareQueueUpdate() noexcept;
+    /// @brief Makes the modified snapshot the active one and waits for the readers of the previous one
+    void publishQueueUpdate() noexcept;
+    void waitForQueueSnapshotReaders(const uint64_t snapshot) noexcept;
+    bool isQueueSnapshotReaderAlive() const noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
+    pid_t m_processId{0};
 };
 
 } // namespace popo
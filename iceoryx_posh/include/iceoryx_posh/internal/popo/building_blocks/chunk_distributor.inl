@@ -25,6 +25,7 @@ template <typename ChunkDistributorDataType>
 inline ChunkDistributor<ChunkDistributorDataType>::ChunkDistributor(
     cxx::not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept
     : m_chunkDistrubutorDataPtr(chunkDistrubutorDataPtr)
+    , m_processId(getpid())
 {
 }
 
@@ -49,18 +50,19 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    const auto& activeQueues = getMembers()->m_queues[getMembers()->m_activeQueueSnapshot.load()];
     const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const ChunkQueueData_t* const queue) { return queue == queueToAdd; });
+        std::find_if(activeQueues.begin(), activeQueues.end(), [&](const ChunkQueueData_t* const queue) {
+            return queue == queueToAdd;
+        });
 
     // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
+    if (alreadyKnownReceiver == activeQueues.end())
     {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        if (activeQueues.size() < activeQueues.capacity())
         {
             // PRQA S 3804 1 # we checked the capacity, so pushing will be fine
-            getMembers()->m_queues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
+            prepareQueueUpdate().push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
 
             const auto currChunkHistorySize = getMembers()->m_history.size();
 
@@ -79,6 +81,9 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
                 deliverToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
             }
 
+            // the history is delivered before the publishers see the new queue to keep the order of the chunks
+            publishQueueUpdate();
+
             return cxx::success<void>();
         }
         else
@@ -100,11 +105,14 @@ inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDat
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
-    if (iter != getMembers()->m_queues.end())
+    const auto& activeQueues = getMembers()->m_queues[getMembers()->m_activeQueueSnapshot.load()];
+    if (std::find(activeQueues.begin(), activeQueues.end(), queueToRemove) != activeQueues.end())
     {
-        // PRQA S 3804 1 # we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
+        auto& queues = prepareQueueUpdate();
+        // PRQA S 3804 1 # we don't use the returned iterator any longer so return value can be ignored
+        queues.erase(std::find(queues.begin(), queues.end(), queueToRemove));
+        // returns after the grace period, i.e. no publisher delivers to the removed queue anymore
+        publishQueueUpdate();
 
         return cxx::success<void>();
     }
@@ -119,15 +127,18 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_queues.clear();
+    prepareQueueUpdate().clear();
+    publishQueueUpdate();
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    const auto snapshot = acquireQueueSnapshot();
+    const bool hasQueues = !getMembers()->m_queues[snapshot].empty();
+    releaseQueueSnapshot(snapshot);
 
-    return !getMembers()->m_queues.empty();
+    return hasQueues;
 }
 
 template <typename ChunkDistributorDataType>
@@ -135,12 +146,12 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
 {
     typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        const auto snapshot = acquireQueueSnapshot();
 
         bool willWaitForSubscriber =
             getMembers()->m_subscriberTooSlowPolicy == SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
         // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+        for (auto& queue : getMembers()->m_queues[snapshot])
         {
             bool isBlockingQueue =
                 (willWaitForSubscriber && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PUBLISHER);
@@ -157,6 +168,8 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
                 }
             }
         }
+
+        releaseQueueSnapshot(snapshot);
     }
 
     // busy waiting until every queue is served
@@ -164,26 +177,16 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
     {
         std::this_thread::yield();
         {
-            // create intersection of current queues and remainingQueues
+            // only deliver to the remaining queues which are still in the current snapshot
             // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            typename ChunkDistributorDataType::QueueContainer_t queueIntersection(remainingQueues.size());
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end());
-            std::sort(remainingQueues.begin(), remainingQueues.end());
-
-            auto iter = std::set_intersection(getMembers()->m_queues.begin(),
-                                              getMembers()->m_queues.end(),
-                                              remainingQueues.begin(),
-                                              remainingQueues.end(),
-                                              queueIntersection.begin());
-            queueIntersection.resize(static_cast<uint64_t>(iter - queueIntersection.begin()));
-            remainingQueues = queueIntersection;
-
-            // deliver to remaining queues
+            //          and without this check we would deliver to dead queues
+            const auto snapshot = acquireQueueSnapshot();
+            const auto& queues = getMembers()->m_queues[snapshot];
+
             for (uint64_t i = remainingQueues.size() - 1U; !remainingQueues.empty(); --i)
             {
-                if (deliverToQueue(remainingQueues[i].get(), chunk))
+                if (std::find(queues.begin(), queues.end(), remainingQueues[i]) == queues.end()
+                    || deliverToQueue(remainingQueues[i].get(), chunk))
                 {
                     remainingQueues.erase(remainingQueues.begin() + i);
                 }
@@ -194,6 +197,8 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
                     break;
                 }
             }
+
+            releaseQueueSnapshot(snapshot);
         }
     }
 
@@ -210,10 +215,11 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(cxx::not_
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
+    // the history capacity is constant, publishers without a history never take the mutex
     if (0u < getMembers()->m_historyCapacity)
     {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
         if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
         {
             auto chunkToRemove = getMembers()->m_history.begin();
@@ -256,6 +262,12 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
+    // the publisher is shut down, a reader count which is still set belongs to a terminated sending application
+    for (auto& readers : getMembers()->m_queueSnapshotReaders)
+    {
+        readers.store(0U);
+    }
+
     if (getMembers()->tryLock())
     {
         clearHistory();
@@ -264,15 +276,98 @@ inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
     else
     {
         /// @todo currently we have a deadlock / mutex destroy vulnerability if the ThreadSafePolicy is used
-        /// and a sending application dies when having the lock for sending. If the RouDi daemon wants to
-        /// cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
-        /// As long as we don't have a multi-threaded lock-free ChunkDistributor or another concept we die here
+        /// and a sending application with a history dies when having the lock for updating the history. If the RouDi
+        /// daemon wants to cleanup or does discovery changes we have a deadlock or an exception when destroying the
+        /// mutex. As long as the history is not lock-free we die here
         errorHandler(Error::kPOPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION,
                      nullptr,
                      ErrorLevel::FATAL);
     }
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::acquireQueueSnapshot() const noexcept
+{
+    // the owner is published before the reader count, a modifier which sees the count also sees the owner
+    if (getMembers()->m_queueSnapshotReaderPid.load(std::memory_order_relaxed) != m_processId)
+    {
+        getMembers()->m_queueSnapshotReaderPid.store(m_processId);
+    }
+
+    while (true)
+    {
+        const uint64_t snapshot = getMembers()->m_activeQueueSnapshot.load();
+        getMembers()->m_queueSnapshotReaders[snapshot].fetch_add(1U);
+
+        // the snapshot might have been swapped before the reader was registered; a modifier could already have
+        // started to update it, therefore we retry with the new active one
+        if (getMembers()->m_activeQueueSnapshot.load() == snapshot)
+        {
+            return snapshot;
+        }
+        getMembers()->m_queueSnapshotReaders[snapshot].fetch_sub(1U);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseQueueSnapshot(const uint64_t snapshot) const noexcept
+{
+    getMembers()->m_queueSnapshotReaders[snapshot].fetch_sub(1U);
+}
+
+template <typename ChunkDistributorDataType>
+inline typename ChunkDistributor<ChunkDistributorDataType>::MemberType_t::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::prepareQueueUpdate() noexcept
+{
+    const uint64_t activeSnapshot = getMembers()->m_activeQueueSnapshot.load();
+    const uint64_t inactiveSnapshot = (activeSnapshot + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+
+    waitForQueueSnapshotReaders(inactiveSnapshot);
+    getMembers()->m_queues[inactiveSnapshot] = getMembers()->m_queues[activeSnapshot];
+
+    return getMembers()->m_queues[inactiveSnapshot];
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::publishQueueUpdate() noexcept
+{
+    const uint64_t previousSnapshot = getMembers()->m_activeQueueSnapshot.load();
+    getMembers()->m_activeQueueSnapshot.store((previousSnapshot + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS);
+
+    waitForQueueSnapshotReaders(previousSnapshot);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::waitForQueueSnapshotReaders(const uint64_t snapshot) noexcept
+{
+    while (getMembers()->m_queueSnapshotReaders[snapshot].load() != 0U)
+    {
+        if (!isQueueSnapshotReaderAlive())
+        {
+            // all readers belong to the terminated process, nobody accesses the snapshot anymore
+            LogWarn() << "The process " << getMembers()->m_queueSnapshotReaderPid.load()
+                      << " was terminated while delivering chunks! Releasing its queue snapshot.";
+            getMembers()->m_queueSnapshotReaders[snapshot].store(0U);
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isQueueSnapshotReaderAlive() const noexcept
+{
+    static constexpr int32_t ERROR_CODE = -1;
+    static constexpr int32_t CHECK_EXISTENCE_ONLY = 0;
+
+    auto checkCommand = posix::posixCall(kill)(getMembers()->m_queueSnapshotReaderPid.load(), CHECK_EXISTENCE_ONLY)
+                            .failureReturnValue(ERROR_CODE)
+                            .ignoreErrnos(ESRCH, EPERM)
+                            .evaluate();
+
+    return !(checkCommand && checkCommand->errnum == ESRCH);
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -22,12 +22,14 @@
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/platform/types.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -48,11 +50,21 @@ struct ChunkDistributorData : public LockingPolicy
 
     const uint64_t m_historyCapacity;
 
+    /// @brief The number of queue snapshots; one is read by the publishers while the other one is updated
+    static constexpr uint64_t NUMBER_OF_QUEUE_SNAPSHOTS{2U};
+
     using QueueContainer_t =
         cxx::vector<rp::RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
-    QueueContainer_t m_queues;
+    /// @brief The queues are only modified by the inactive snapshot which becomes the active one afterwards. This
+    /// allows the publisher to read the active snapshot without the mutex, which is only held by the modifiers
+    QueueContainer_t m_queues[NUMBER_OF_QUEUE_SNAPSHOTS];
+    std::atomic<uint64_t> m_activeQueueSnapshot{0U};
+    mutable std::atomic<uint64_t> m_queueSnapshotReaders[NUMBER_OF_QUEUE_SNAPSHOTS];
+    /// @brief The process which owns the reader counts. A queue update waits until a snapshot has no readers unless
+    /// this process was terminated while reading
+    mutable std::atomic<pid_t> m_queueSnapshotReaderPid{0};
 
-    /// @todo If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
+    /// @todo Now that the queue fan-out is lock-free, can we extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
     /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
     /// crash.
@@ -30,6 +30,10 @@ constexpr T min(const T left, const T right) noexcept
     return (left < right) ? left : right;
 }
 
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+constexpr uint64_t ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::
+    NUMBER_OF_QUEUE_SNAPSHOTS;
+
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::ChunkDistributorData(
     const SubscriberTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
@@ -37,6 +41,11 @@ inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, Chunk
     , m_historyCapacity(min(historyCapacity, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY))
     , m_subscriberTooSlowPolicy(policy)
 {
+    for (auto& readers : m_queueSnapshotReaders)
+    {
+        readers.store(0U, std::memory_order_relaxed);
+    }
+
     if (m_historyCapacity != historyCapacity)
     {
         LogWarn() << "Chunk history too large, reducing from " << historyCapacity << " to "
@@ -85,7 +85,12 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
         // get a new chunk
-        mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        // with MemPoolExhaustedPolicy::WAIT_FOR_CHUNK the memory manager waits until a chunk is freed
+        mepoo::SharedChunk chunk =
+            (getMembers()->m_memPoolExhaustedPolicy == MemPoolExhaustedPolicy::WAIT_FOR_CHUNK)
+                ? getMembers()->m_memoryMgr->getChunk(
+                    chunkSettings, getMembers()->m_chunkMagazine, getMembers()->m_loanTimeout)
+                : getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkMagazine);
 
         if (chunk)
         {
@@ -170,6 +175,7 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_memoryMgr->releaseChunkMagazine(getMembers()->m_chunkMagazine);
 }
 
 template <typename ChunkSenderDataType>
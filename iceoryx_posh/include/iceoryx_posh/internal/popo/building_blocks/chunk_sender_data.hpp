@@ -44,6 +44,9 @@ struct ChunkSenderData : public ChunkDistributorDataType
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    mepoo::ChunkMagazine m_chunkMagazine;
+    MemPoolExhaustedPolicy m_memPoolExhaustedPolicy{MemPoolExhaustedPolicy::RETURN_ERROR};
+    units::Duration m_loanTimeout{units::Duration::max()};
 };
 
 } // namespace popo
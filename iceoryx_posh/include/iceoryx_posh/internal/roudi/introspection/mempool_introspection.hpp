@@ -17,6 +17,7 @@
 #define IOX_POSH_ROUDI_INTROSPECTION_MEMPOOL_INTROSPECTION_HPP
 
 #include "iceoryx_hoofs/cxx/method_callback.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
@@ -57,6 +58,11 @@ class MemPoolIntrospection
     MemPoolIntrospection(MemPoolIntrospection&&) = delete;
     MemPoolIntrospection& operator=(MemPoolIntrospection&&) = delete;
 
+    /// @brief This function registers the publisher port for the allocation statistics of the mempools which are
+    ///        sent together with the mempool introspection data.
+    /// @param[in] publisherPort is the publisher port for transmission of the mempool statistics
+    void registerStatisticsPublisherPort(PublisherPort&& publisherPort) noexcept;
+
     /// @brief This function starts the periodic transmission of snapshots of the mempool introspecton data.
     ///        The send interval can be set by @ref setSendInterval "setSendInterval(...)". By default it's 1 second.
     void run() noexcept;
@@ -74,17 +80,25 @@ class MemPoolIntrospection
     MemoryManager* m_rouDiInternalMemoryManager{nullptr}; // mempool handler needs to outlive this class (!)
     SegmentManager* m_segmentManager{nullptr};
     PublisherPort m_publisherPort{nullptr};
+    cxx::optional<PublisherPort> m_statisticsPublisherPort;
     void send() noexcept;
+    void sendStatistics() noexcept;
 
   private:
     static void prepareIntrospectionSample(MemPoolIntrospectionInfo& sample,
                                            const posix::PosixGroup& readerGroup,
                                            const posix::PosixGroup& writerGroup,
-                                           uint32_t id) noexcept;
+                                           uint32_t id,
+                                           uint64_t pageSize,
+                                           int32_t numaNode) noexcept;
 
     /// @brief copy data fro internal struct into interface struct
     void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
 
+    /// @brief accumulates the allocation statistics of a memory manager and of all its extensions
+    void copyMemPoolStatistics(const MemoryManager& memoryManager,
+                               cxx::vector<MemPoolStatistics, MAX_NUMBER_OF_MEMPOOLS>& dest) noexcept;
+
   private:
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
     concurrent::PeriodicTask<cxx::MethodCallback<void>> m_publishingTask{
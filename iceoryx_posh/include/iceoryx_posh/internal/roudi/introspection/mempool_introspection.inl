@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_ROUDI_INTROSPECTION_MEMPOOL_INTROSPECTION_INL
 #define IOX_POSH_ROUDI_INTROSPECTION_MEMPOOL_INTROSPECTION_INL
 
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
 #include "mempool_introspection.hpp"
 
@@ -39,6 +40,22 @@ inline MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::~MemP
 {
     stop();
     m_publisherPort.stopOffer();
+    if (m_statisticsPublisherPort.has_value())
+    {
+        m_statisticsPublisherPort->stopOffer();
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
+inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::registerStatisticsPublisherPort(
+    PublisherPort&& publisherPort) noexcept
+{
+    // we do not want to call this twice
+    if (!m_statisticsPublisherPort.has_value())
+    {
+        m_statisticsPublisherPort.emplace(std::move(publisherPort));
+        m_statisticsPublisherPort->offer();
+    }
 }
 
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
@@ -70,13 +87,17 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
     MemPoolIntrospectionInfo& sample,
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
-    uint32_t id) noexcept
+    uint32_t id,
+    uint64_t pageSize,
+    int32_t numaNode) noexcept
 {
     sample.m_readerGroupName.assign("");
     sample.m_readerGroupName.append(cxx::TruncateToCapacity, readerGroup.getName());
     sample.m_writerGroupName.assign("");
     sample.m_writerGroupName.append(cxx::TruncateToCapacity, writerGroup.getName());
     sample.m_id = id;
+    sample.m_pageSize = pageSize;
+    sample.m_numaNode = numaNode;
 }
 
 
@@ -107,25 +128,32 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
             prepareIntrospectionSample(memPoolIntrospectionInfo,
                                        posix::PosixGroup::getGroupOfCurrentProcess(),
                                        posix::PosixGroup::getGroupOfCurrentProcess(),
-                                       id);
+                                       id,
+                                       posix::pageSize(),
+                                       posix::SharedMemoryObject::UNKNOWN_NUMA_NODE);
             copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
             ++id;
 
-            // User shm segments
-            for (auto& segment : m_segmentManager->m_segmentContainer)
+            // User shm segments including the extensions which were added at runtime
+            const uint64_t numberOfSegments = m_segmentManager->numberOfSegments();
+            for (uint64_t i = 0U; i < numberOfSegments; ++i)
             {
+                auto& segment = m_segmentManager->segmentAt(i);
                 if (sample->emplace_back())
                 {
                     auto& memPoolIntrospectionInfo = sample->back();
-                    prepareIntrospectionSample(
-                        memPoolIntrospectionInfo, segment.getReaderGroup(), segment.getWriterGroup(), id);
+                    prepareIntrospectionSample(memPoolIntrospectionInfo,
+                                               segment.getReaderGroup(),
+                                               segment.getWriterGroup(),
+                                               id,
+                                               segment.getSharedMemoryObject().getPageSize(),
+                                               segment.getSharedMemoryObject().getNumaNode());
                     copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo);
                 }
                 else
                 {
                     LogWarn() << "Mempool Introspection Container full, Mempool Introspection Data not fully updated! "
-                              << (id + 1U) << " of " << m_segmentManager->m_segmentContainer.size()
-                              << " memory segments sent.";
+                              << (id + 1U) << " of " << numberOfSegments << " memory segments sent.";
                     errorHandler(Error::kMEPOO__INTROSPECTION_CONTAINER_FULL, nullptr, ErrorLevel::MODERATE);
                     break;
                 }
@@ -135,12 +163,56 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
         else
         {
             LogWarn() << "Mempool Introspection Container full, Mempool Introspection Data not fully updated! "
-                      << (id + 1U) << " of " << m_segmentManager->m_segmentContainer.size() << " memory segments sent.";
+                      << (id + 1U) << " of " << m_segmentManager->numberOfSegments() << " memory segments sent.";
             errorHandler(Error::kMEPOO__INTROSPECTION_CONTAINER_FULL, nullptr, ErrorLevel::MODERATE);
         }
 
         m_publisherPort.sendChunk(maybeChunkHeader.value());
     }
+
+    sendStatistics();
+}
+
+template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
+inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::sendStatistics() noexcept
+{
+    if (!m_statisticsPublisherPort.has_value() || !m_statisticsPublisherPort->hasSubscribers())
+    {
+        return;
+    }
+
+    auto maybeChunkHeader = m_statisticsPublisherPort->tryAllocateChunk(sizeof(MemPoolStatisticsInfoContainer),
+                                                                        alignof(MemPoolStatisticsInfoContainer),
+                                                                        CHUNK_NO_USER_HEADER_SIZE,
+                                                                        CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (maybeChunkHeader.has_error())
+    {
+        LogWarn() << "Cannot allocate chunk for mempool statistics!";
+        errorHandler(Error::kMEPOO__CANNOT_ALLOCATE_CHUNK, nullptr, ErrorLevel::MODERATE);
+        return;
+    }
+
+    auto sample = static_cast<MemPoolStatisticsInfoContainer*>(maybeChunkHeader.value()->userPayload());
+    new (sample) MemPoolStatisticsInfoContainer;
+
+    // the id 0 is used for the shm segment of RouDi in the mempool introspection
+    const uint64_t numberOfSegments = m_segmentManager->numberOfSegments();
+    for (uint64_t i = 0U; i < numberOfSegments; ++i)
+    {
+        auto& segment = m_segmentManager->segmentAt(i);
+        // the statistics of the extensions are accumulated in the segment they extend
+        if (segment.getExtensionIndex() != 0U || !sample->emplace_back())
+        {
+            continue;
+        }
+        auto& statistics = sample->back();
+        statistics.m_id = static_cast<uint32_t>(i + 1U);
+        statistics.m_writerGroupName.append(cxx::TruncateToCapacity, segment.getWriterGroup().getName());
+        statistics.m_readerGroupName.append(cxx::TruncateToCapacity, segment.getReaderGroup().getName());
+        copyMemPoolStatistics(segment.getMemoryManager(), statistics.m_mempoolStatistics);
+    }
+
+    m_statisticsPublisherPort->sendChunk(maybeChunkHeader.value());
 }
 
 // copy data fro internal struct into interface struct
@@ -160,6 +232,44 @@ MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolI
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+        dst.m_cachedChunks = src.m_cachedChunks;
+        dst.m_maxChunkSize = src.m_maxChunkSize;
+        dst.m_internalFragmentation = src.m_internalFragmentation;
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
+inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolStatistics(
+    const MemoryManager& memoryManager, cxx::vector<MemPoolStatistics, MAX_NUMBER_OF_MEMPOOLS>& dest) noexcept
+{
+    auto numOfMemPools = memoryManager.getNumberOfMemPools();
+    dest = cxx::vector<MemPoolStatistics, MAX_NUMBER_OF_MEMPOOLS>(numOfMemPools, MemPoolStatistics());
+    for (const MemoryManager* current = &memoryManager; current != nullptr; current = current->getExtension())
+    {
+        for (uint32_t i = 0U; i < numOfMemPools; ++i)
+        {
+            auto src = current->getMemPoolInfo(i);
+            auto& dst = dest[i];
+            // a mempool with multiple chunk sizes counts its chunks in chunks of the smallest size
+            const uint32_t smallestChunksPerChunk = (src.m_chunkSize == 0U) ? 1U : src.m_maxChunkSize / src.m_chunkSize;
+            const uint32_t peakUsedChunks = src.m_numChunks - src.m_minFreeChunks;
+            dst.m_chunkPayloadSize = src.m_maxChunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+            dst.m_numChunks += src.m_numChunks / smallestChunksPerChunk;
+            dst.m_peakUsedChunks += (peakUsedChunks + smallestChunksPerChunk - 1U) / smallestChunksPerChunk;
+            for (uint32_t bin = 0U; bin < NUMBER_OF_MEMPOOL_HISTOGRAM_BINS; ++bin)
+            {
+                const auto& srcBin = src.m_histogram[bin];
+                auto& dstBin = dst.m_histogram[bin];
+                dstBin.m_numberOfRequests += srcBin.m_numberOfRequests;
+                dstBin.m_peakUsedChunks += srcBin.m_peakUsedChunks;
+                if (srcBin.m_numberOfRequests > 0U)
+                {
+                    dstBin.m_maxRequestedChunkPayloadSize =
+                        std::max(dstBin.m_maxRequestedChunkPayloadSize,
+                                 srcBin.m_maxRequestedChunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader)));
+                }
+            }
+        }
     }
 }
 
@@ -22,6 +22,9 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/base_relative_pointer.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
+
+#include <mutex>
 
 
 namespace iox
@@ -45,6 +48,31 @@ class SharedMemoryUser
     void openDataSegments(const uint64_t segmentId,
                           const rp::BaseRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
 
+    static cxx::expected<posix::SharedMemoryObject, posix::SharedMemoryObjectError>
+    openDataSegment(const mepoo::SegmentManager<>::SegmentMapping& segment) noexcept;
+
+    /// @brief maps a payload segment which RouDi added at runtime when a relative pointer to it is dereferenced for
+    /// the first time; is called by the BaseRelativePointer for segment ids which are not registered
+    /// @param[in] segmentId of the segment
+    /// @return the base address of the segment or nullptr if the segment is not accessible by the process
+    static void* mapSegmentOnDemand(const rp::BaseRelativePointer::id_t segmentId) noexcept;
+
+    /// @brief the segments which are mapped on demand; since the relative pointers are translated process-wide, the
+    /// segments are also mapped process-wide and stay mapped until the process terminates
+    struct OnDemandSegments
+    {
+        struct MappedSegment
+        {
+            rp::BaseRelativePointer::id_t m_segmentId;
+            posix::SharedMemoryObject m_sharedMemoryObject;
+        };
+
+        std::mutex m_mutex;
+        mepoo::SegmentManager<>* m_segmentManager{nullptr};
+        cxx::vector<MappedSegment, MAX_SHM_SEGMENTS> m_mappedSegments;
+    };
+    static OnDemandSegments& onDemandSegments() noexcept;
+
   private:
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
     cxx::vector<posix::SharedMemoryObject, MAX_SHM_SEGMENTS> m_dataShmObjects;
@@ -29,23 +29,42 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines where the ChunkManagement with the reference counter of a chunk is stored
+/// MEMPOOL - in a dedicated mempool of the management segment
+/// EMBEDDED - in front of the ChunkHeader in the chunk memory; this saves a free-list operation and a cache miss
+/// per chunk but increases the size of each chunk
+enum class ChunkManagementLayout : uint8_t
+{
+    MEMPOOL,
+    EMBEDDED
+};
+
 struct MePooConfig
 {
   public:
     struct Entry
     {
         /// @brief set the size and count of memory chunks
-        Entry(uint32_t f_size, uint32_t f_chunkCount) noexcept
+        /// @param[in] f_magazineCapacity number of free chunks each publisher port caches for this mempool;
+        /// 0 disables the cache, the maximum is MAX_CHUNK_MAGAZINE_CAPACITY
+        /// @param[in] f_minSize if not 0 and smaller than f_size, the chunks are split into buddies down to this
+        /// chunk-payload size for smaller requests; such a mempool does not support a magazine
+        Entry(uint32_t f_size, uint32_t f_chunkCount, uint32_t f_magazineCapacity = 0U, uint32_t f_minSize = 0U) noexcept
             : m_size(f_size)
             , m_chunkCount(f_chunkCount)
+            , m_magazineCapacity(f_magazineCapacity)
+            , m_minSize(f_minSize)
         {
         }
         uint32_t m_size{0};
         uint32_t m_chunkCount{0};
+        uint32_t m_magazineCapacity{0};
+        uint32_t m_minSize{0};
     };
 
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    ChunkManagementLayout m_chunkManagementLayout{ChunkManagementLayout::MEMPOOL};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
 #include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
@@ -27,6 +28,19 @@ namespace iox
 {
 namespace mepoo
 {
+/// @brief the policy to extend a segment at runtime with additional payload segments instead of provisioning the
+/// segment for the worst case at startup
+struct SegmentGrowth
+{
+    static constexpr uint32_t DEFAULT_HIGH_WATER_MARK{80U};
+
+    /// @brief the max number of payload segments with the same mempools which are added to the segment at runtime;
+    /// 0 disables the growth
+    uint32_t m_maxExtensions{0U};
+    /// @brief the percentage of used chunks of a mempool above which RouDi adds the next payload segment
+    uint32_t m_highWaterMark{DEFAULT_HIGH_WATER_MARK};
+};
+
 struct SegmentConfig
 {
     struct SegmentEntry
@@ -34,11 +48,17 @@ struct SegmentConfig
         SegmentEntry(const posix::PosixGroup::string_t& readerGroup,
                      const posix::PosixGroup::string_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const uint64_t hugePageSize = posix::SharedMemory::NO_HUGE_PAGES,
+                     const posix::SharedMemoryProvisioning& provisioning = posix::SharedMemoryProvisioning(),
+                     const SegmentGrowth& growth = SegmentGrowth()) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_hugePageSize(hugePageSize)
+            , m_provisioning(provisioning)
+            , m_growth(growth)
 
         {
         }
@@ -47,6 +67,13 @@ struct SegmentConfig
         posix::PosixGroup::string_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        /// @brief the size of the huge pages which shall back the segment; if no hugetlbfs with this page size is
+        /// available, the segment falls back to the default page size
+        uint64_t m_hugePageSize{posix::SharedMemory::NO_HUGE_PAGES};
+        /// @brief how RouDi zeroes, prefaults and locks the memory of the segment at startup
+        posix::SharedMemoryProvisioning m_provisioning;
+        /// @brief how RouDi extends the segment at runtime
+        SegmentGrowth m_growth;
     };
 
     cxx::vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
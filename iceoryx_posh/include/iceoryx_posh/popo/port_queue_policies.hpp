@@ -38,6 +38,15 @@ enum class QueueFullPolicy : uint8_t
     DISCARD_OLDEST_DATA
 };
 
+/// @brief Used by publisher how to react when the mempool has no free chunk for a loan
+enum class MemPoolExhaustedPolicy : uint8_t
+{
+    /// The loan fails immediately with AllocationError::RUNNING_OUT_OF_CHUNKS
+    RETURN_ERROR,
+    /// The loan waits until a chunk is freed or the loan timeout elapsed
+    WAIT_FOR_CHUNK
+};
+
 /// @brief Used by producers how to adjust to slow consumer
 enum class ConsumerTooSlowPolicy
 {
@@ -39,6 +39,13 @@ struct PublisherOptions
 
     /// @brief The option whether the publisher should block when the subscriber queue is full
     SubscriberTooSlowPolicy subscriberTooSlowPolicy{SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA};
+
+    /// @brief The option whether loan should wait for a free chunk when the mempool is exhausted
+    MemPoolExhaustedPolicy memPoolExhaustedPolicy{MemPoolExhaustedPolicy::RETURN_ERROR};
+
+    /// @brief The maximum time loan waits for a free chunk with MemPoolExhaustedPolicy::WAIT_FOR_CHUNK; the default
+    /// waits without timeout
+    units::Duration loanTimeout{units::Duration::max()};
 };
 
 } // namespace popo
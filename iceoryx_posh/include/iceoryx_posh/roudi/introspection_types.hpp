@@ -42,6 +42,13 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_chunkPayloadSize{0};
+    /// @brief chunks which are cached in the magazines of the publishers and therefore not free for other publishers
+    uint32_t m_cachedChunks{0};
+    /// @brief the largest chunk size if the chunks of the mempool can be split into buddies; the chunks are then
+    /// counted in chunks of m_chunkSize which is the smallest chunk size
+    uint32_t m_maxChunkSize{0};
+    /// @brief the bytes of the used chunks which are not used by the ChunkHeader, user-header and user-payload
+    uint64_t m_internalFragmentation{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -53,12 +60,60 @@ struct MemPoolIntrospectionInfo
     uint32_t m_id;
     cxx::string<MAX_GROUP_NAME_LENGTH> m_writerGroupName;
     cxx::string<MAX_GROUP_NAME_LENGTH> m_readerGroupName;
+    /// @brief the size of the pages which back the segment; larger than the default page size for huge pages
+    uint64_t m_pageSize{0U};
+    /// @brief the NUMA node on which the segment starts; -1 if unknown
+    int32_t m_numaNode{-1};
     MemPoolInfoContainer m_mempoolInfo;
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
 using MemPoolIntrospectionInfoContainer = cxx::vector<MemPoolIntrospectionInfo, MAX_SHM_SEGMENTS + 1>;
 
+const capro::ServiceDescription
+    IntrospectionMemPoolStatisticsService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "MemPoolStatistics");
+
+/// @brief a bin of the histogram of the chunk sizes which were requested from a mempool; the bin 'b' contains the
+/// requests whose chunk size is 'b' size buckets smaller than the chunk size of the mempool, with four size buckets
+/// per power of two. The last bin also contains all smaller requests
+struct MemPoolHistogramBin
+{
+    /// @brief the number of chunks which were acquired for requests of this bin
+    uint64_t m_numberOfRequests{0};
+    /// @brief the largest requested chunk size without the ChunkHeader, i.e. the chunk-payload size a mempool needs
+    /// to serve all requests of this bin
+    uint32_t m_maxRequestedChunkPayloadSize{0};
+    /// @brief the maximum number of chunks of this bin which were in use at the same time
+    uint32_t m_peakUsedChunks{0};
+};
+
+/// @brief struct for the allocation statistics of a mempool; the statistics of the extensions of a segment which
+/// were added at runtime are accumulated
+struct MemPoolStatistics
+{
+    /// @brief the largest chunk-payload size of the mempool
+    uint32_t m_chunkPayloadSize{0};
+    /// @brief the number of chunks with the largest chunk-payload size
+    uint32_t m_numChunks{0};
+    /// @brief the maximum number of chunks which were in use at the same time; the split chunks of a mempool with
+    /// multiple chunk sizes are rounded up to chunks of the largest size
+    uint32_t m_peakUsedChunks{0};
+    MemPoolHistogramBin m_histogram[NUMBER_OF_MEMPOOL_HISTOGRAM_BINS];
+};
+
+/// @brief the topic for the mempool statistics that a user can subscribe to; the id of a segment is the same as in
+/// the MemPoolIntrospectionInfo
+struct MemPoolStatisticsInfo
+{
+    uint32_t m_id{0U};
+    cxx::string<MAX_GROUP_NAME_LENGTH> m_writerGroupName;
+    cxx::string<MAX_GROUP_NAME_LENGTH> m_readerGroupName;
+    cxx::vector<MemPoolStatistics, MAX_NUMBER_OF_MEMPOOLS> m_mempoolStatistics;
+};
+
+/// @brief container for the mempool statistics of all payload segments
+using MemPoolStatisticsInfoContainer = cxx::vector<MemPoolStatisticsInfo, MAX_SHM_SEGMENTS>;
+
 /// @brief publisher/subscriber port information consisting of a process name,a capro service description string
 /// and a node name
 const capro::ServiceDescription IntrospectionPortService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "Port");
@@ -0,0 +1,64 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_MEMPOOL_CONFIG_GENERATOR_HPP
+#define IOX_POSH_ROUDI_MEMPOOL_CONFIG_GENERATOR_HPP
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Generates the mempool config of a segment from the allocation statistics which were collected by a running
+/// RouDi. Every bin of the histograms of the requested chunk sizes with at least one request results in a mempool
+/// whose chunk-payload size is the largest requested one of the bin and whose chunk count is the peak of the used
+/// chunks of the bin plus the headroom. Mempools with the same size are merged; if there are more than
+/// MAX_NUMBER_OF_MEMPOOLS, the neighbouring mempools whose merge wastes the least memory are merged. Mempools without
+/// any request are omitted, a segment without any request keeps its mempools.
+class MemPoolConfigGenerator
+{
+  public:
+    static constexpr uint32_t DEFAULT_HEADROOM_PERCENT{20U};
+
+    /// @brief creates a generator
+    /// @param[in] headroomPercent is the number of chunks in percent of the peak of the used chunks which is added to
+    /// the chunk count of each mempool
+    explicit MemPoolConfigGenerator(const uint32_t headroomPercent = DEFAULT_HEADROOM_PERCENT) noexcept;
+
+    /// @brief generates the mempool config for a segment
+    /// @param[in] statistics of the mempools of the segment
+    /// @return the mempool config which is ordered by increasing chunk-payload size
+    mepoo::MePooConfig generate(const MemPoolStatisticsInfo& statistics) const noexcept;
+
+  private:
+    using Candidates_t =
+        cxx::vector<mepoo::MePooConfig::Entry, MAX_NUMBER_OF_MEMPOOLS * NUMBER_OF_MEMPOOL_HISTOGRAM_BINS>;
+
+    uint32_t chunkCountWithHeadroom(const uint32_t peakUsedChunks) const noexcept;
+    static void mergeEqualSizes(Candidates_t& candidates) noexcept;
+    static void mergeCheapestNeighbours(Candidates_t& candidates) noexcept;
+
+    uint32_t m_headroomPercent{DEFAULT_HEADROOM_PERCENT};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_MEMPOOL_CONFIG_GENERATOR_HPP
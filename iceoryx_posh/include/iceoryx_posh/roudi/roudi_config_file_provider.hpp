@@ -30,11 +30,22 @@ namespace roudi
 /// NO_GENERAL_SECTION - the section for general config was not found
 /// INVALID_CONFIG_FILE_VERSION - an invalid config file version was detected
 /// NO_SEGMENTS - at least one segment needs to be defined
-/// MAX_NUMBER_OF_SEGMENTS_EXCEEDED - max number of segments exceeded
+/// MAX_NUMBER_OF_SEGMENTS_EXCEEDED - max number of segments including the max number of extensions exceeded
 /// SEGMENT_WITHOUT_MEMPOOL - a segment must have at least one mempool
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// MEMPOOL_MAGAZINE_CAPACITY_EXCEEDED - the magazine capacity of the mempool exceeds MAX_CHUNK_MAGAZINE_CAPACITY
+/// INVALID_MEMPOOL_MIN_SIZE - the min size of the mempool is either 0 or not smaller than the size
+/// MEMPOOL_MAGAZINE_WITH_MIN_SIZE - a magazine is configured for a mempool with a min size
+/// INVALID_CHUNK_MANAGEMENT_LAYOUT - the chunk management layout of the segment is neither "mempool" nor "embedded"
+/// EMBEDDED_CHUNK_MANAGEMENT_WITH_DIFFERENT_READER_AND_WRITER_GROUP - the embedded chunk management layout is used for a
+/// segment whose reader group differs from the writer group
+/// INVALID_HUGE_PAGE_SIZE - the huge page size of the segment is neither "none", "2M" nor "1G"
+/// INVALID_PREFAULT_MODE - the prefault mode of the segment is neither "none", "touch" nor "populate"
+/// INVALID_NUMA_POLICY - the NUMA policy of the segment is neither "default", "bind", "interleave" nor "preferred"
+/// INVALID_NUMA_NODES - the NUMA nodes of the segment are missing for a NUMA policy or exceed the max NUMA node
+/// INVALID_HIGH_WATER_MARK - the high-water mark of the segment is not a percentage in the range [1, 100]
 enum class RouDiConfigFileParseError
 {
     INVALID_STATE,
@@ -46,6 +57,16 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    MEMPOOL_MAGAZINE_CAPACITY_EXCEEDED,
+    INVALID_MEMPOOL_MIN_SIZE,
+    MEMPOOL_MAGAZINE_WITH_MIN_SIZE,
+    INVALID_CHUNK_MANAGEMENT_LAYOUT,
+    EMBEDDED_CHUNK_MANAGEMENT_WITH_DIFFERENT_READER_AND_WRITER_GROUP,
+    INVALID_HUGE_PAGE_SIZE,
+    INVALID_PREFAULT_MODE,
+    INVALID_NUMA_POLICY,
+    INVALID_NUMA_NODES,
+    INVALID_HIGH_WATER_MARK,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +79,17 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"INVALID_STATE"
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "MEMPOOL_MAGAZINE_CAPACITY_EXCEEDED",
+                                                                 "INVALID_MEMPOOL_MIN_SIZE",
+                                                                 "MEMPOOL_MAGAZINE_WITH_MIN_SIZE",
+                                                                 "INVALID_CHUNK_MANAGEMENT_LAYOUT",
+                                                                 "EMBEDDED_CHUNK_MANAGEMENT_WITH_DIFFERENT_READER_AND_"
+                                                                 "WRITER_GROUP",
+                                                                 "INVALID_HUGE_PAGE_SIZE",
+                                                                 "INVALID_PREFAULT_MODE",
+                                                                 "INVALID_NUMA_POLICY",
+                                                                 "INVALID_NUMA_NODES",
+                                                                 "INVALID_HIGH_WATER_MARK",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
@@ -22,6 +22,8 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint8_t ChunkManagement::NO_HISTOGRAM_BIN;
+
 ChunkManagement::ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
                                  const cxx::not_null<MemPool*> mempool,
                                  const cxx::not_null<MemPool*> chunkManagementPool) noexcept
@@ -34,6 +36,17 @@ ChunkManagement::ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
                   "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
 }
 
+ChunkManagement::ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
+                                 const cxx::not_null<MemPool*> mempool) noexcept
+    : m_chunkHeader(chunkHeader)
+    , m_mempool(mempool)
+{
+}
+
+bool ChunkManagement::isEmbedded() const noexcept
+{
+    return m_chunkManagementPool == nullptr;
+}
 
 } // namespace mepoo
 } // namespace iox
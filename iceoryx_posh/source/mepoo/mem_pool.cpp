@@ -17,11 +17,13 @@
 
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 
+#include "iceoryx_hoofs/cxx/attributes.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 #include <algorithm>
+#include <limits>
 
 namespace iox
 {
@@ -30,11 +32,14 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint32_t chunkSize) noexcept
+                         const uint32_t chunkSize,
+                         const uint32_t cachedChunks) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_cachedChunks(cachedChunks)
+    , m_maxChunkSize(chunkSize)
 {
 }
 
@@ -43,18 +48,42 @@ constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
 MemPool::MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
                  posix::Allocator& managementAllocator,
-                 posix::Allocator& chunkMemoryAllocator) noexcept
+                 posix::Allocator& chunkMemoryAllocator,
+                 const uint32_t magazineCapacity,
+                 const uint32_t numberOfChunkSizes) noexcept
     : m_chunkSize(chunkSize)
     , m_numberOfChunks(numberOfChunks)
-    , m_minFree(numberOfChunks)
+    , m_magazineCapacity(magazineCapacity)
+    , m_numberOfChunkSizes(numberOfChunkSizes)
 {
-    if (isMultipleOfAlignment(chunkSize))
+    cxx::Expects(magazineCapacity <= MAX_CHUNK_MAGAZINE_CAPACITY && "Magazine capacity exceeds limits!");
+    cxx::Expects(numberOfChunkSizes >= 1U && numberOfChunkSizes <= concurrent::BuddyFreeList::MAX_NUMBER_OF_ORDERS
+                 && "Number of chunk sizes exceeds limits!");
+    cxx::Expects((numberOfChunkSizes == 1U || magazineCapacity == 0U)
+                 && "Magazines are not supported for multiple chunk sizes!");
+    cxx::Expects((static_cast<uint64_t>(m_numberOfChunks) << (m_numberOfChunkSizes - 1U))
+                     <= std::numeric_limits<uint32_t>::max()
+                 && "Number of chunks of the smallest size exceeds limits!");
+    m_minFree.store(numberOfSmallestChunks(), std::memory_order_relaxed);
+
+    if (isMultipleOfAlignment(chunkSize) && isMultipleOfAlignment(getMinChunkSize())
+        && (getMinChunkSize() << (m_numberOfChunkSizes - 1U)) == m_chunkSize)
     {
         m_rawMemory = static_cast<uint8_t*>(chunkMemoryAllocator.allocate(
             static_cast<uint64_t>(m_numberOfChunks) * m_chunkSize, CHUNK_MEMORY_ALIGNMENT));
-        auto memoryLoFFLi =
-            managementAllocator.allocate(freeList_t::requiredIndexMemorySize(m_numberOfChunks), CHUNK_MEMORY_ALIGNMENT);
-        m_freeIndices.init(static_cast<concurrent::LoFFLi::Index_t*>(memoryLoFFLi), m_numberOfChunks);
+        if (hasMultipleChunkSizes())
+        {
+            auto memoryBuddies = managementAllocator.allocate(
+                concurrent::BuddyFreeList::requiredMemorySize(m_numberOfChunks, m_numberOfChunkSizes),
+                CHUNK_MEMORY_ALIGNMENT);
+            m_freeBuddies.init(memoryBuddies, m_numberOfChunks, m_numberOfChunkSizes);
+        }
+        else
+        {
+            auto memoryLoFFLi = managementAllocator.allocate(freeList_t::requiredIndexMemorySize(m_numberOfChunks),
+                                                             CHUNK_MEMORY_ALIGNMENT);
+            m_freeIndices.init(static_cast<concurrent::LoFFLi::Index_t*>(memoryLoFFLi), m_numberOfChunks);
+        }
     }
     else
     {
@@ -68,33 +97,148 @@ bool MemPool::isMultipleOfAlignment(const uint32_t value) const noexcept
     return (value % CHUNK_MEMORY_ALIGNMENT == 0U);
 }
 
+bool MemPool::hasMultipleChunkSizes() const noexcept
+{
+    return m_numberOfChunkSizes > 1U;
+}
+
+uint32_t MemPool::numberOfSmallestChunks() const noexcept
+{
+    return m_numberOfChunks << (m_numberOfChunkSizes - 1U);
+}
+
 void MemPool::adjustMinFree() noexcept
 {
     // @todo rethink the concurrent change that can happen. do we need a CAS loop?
-    m_minFree.store(std::min(m_numberOfChunks - m_usedChunks.load(std::memory_order_relaxed),
+    // chunks which are cached in magazines cannot be acquired by other ports and are therefore not free
+    const uint32_t unavailableChunks =
+        m_usedChunks.load(std::memory_order_relaxed) + m_cachedChunks.load(std::memory_order_relaxed);
+    const uint32_t numberOfChunks = numberOfSmallestChunks();
+    m_minFree.store(std::min(numberOfChunks - std::min(unavailableChunks, numberOfChunks),
                              m_minFree.load(std::memory_order_relaxed)));
 }
 
+void* MemPool::acquireChunk(const uint32_t index) noexcept
+{
+    /// @todo: verify that m_usedChunk is not changed during adjustMInFree
+    ///         without changing m_minFree
+    m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
+    adjustMinFree();
+
+    return m_rawMemory + index * m_chunkSize;
+}
+
 void* MemPool::getChunk() noexcept
 {
+    if (hasMultipleChunkSizes())
+    {
+        return getChunk(m_chunkSize);
+    }
+
     uint32_t l_index{0U};
     if (!m_freeIndices.pop(l_index))
     {
-        std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
-                  << ", used_chunks = " << m_usedChunks << " ] has no more space left" << std::endl;
         return nullptr;
     }
 
-    /// @todo: verify that m_usedChunk is not changed during adjustMInFree
-    ///         without changing m_minFree
-    m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
+    return acquireChunk(l_index);
+}
+
+uint32_t MemPool::fittingChunkSize(const uint32_t requiredChunkSize) const noexcept
+{
+    uint32_t chunkSize = getMinChunkSize();
+    while (chunkSize < requiredChunkSize && chunkSize < m_chunkSize)
+    {
+        chunkSize <<= 1U;
+    }
+    return chunkSize;
+}
+
+void* MemPool::getChunk(const uint32_t chunkSize) noexcept
+{
+    if (!hasMultipleChunkSizes())
+    {
+        return getChunk();
+    }
+
+    const uint32_t minChunkSize = getMinChunkSize();
+    uint32_t order{0U};
+    while ((minChunkSize << order) < chunkSize)
+    {
+        ++order;
+    }
+    cxx::Expects((minChunkSize << order) == chunkSize && order < m_numberOfChunkSizes
+                 && "The chunk size is not provided by the mempool!");
+
+    uint32_t index{0U};
+    if (!m_freeBuddies.pop(order, index))
+    {
+        return nullptr;
+    }
+
+    m_usedChunks.fetch_add(1U << order, std::memory_order_relaxed);
     adjustMinFree();
 
-    return m_rawMemory + l_index * m_chunkSize;
+    return m_rawMemory + static_cast<uint64_t>(index) * minChunkSize;
+}
+
+void* MemPool::getChunk(MemPoolMagazine& magazine) noexcept
+{
+    if (m_magazineCapacity == 0U)
+    {
+        return getChunk();
+    }
+
+    if (magazine.m_numberOfIndices == 0U)
+    {
+        // popBatch stores the number of indices in the magazine directly after they are taken from the free list;
+        // if the process terminates during the refill, releaseMagazine returns them nevertheless
+        magazine.m_refillInProgress = true;
+        m_freeIndices.popBatch(magazine.m_indices, m_magazineCapacity, magazine.m_numberOfIndices);
+        magazine.m_refillInProgress = false;
+        if (magazine.m_numberOfIndices == 0U)
+        {
+            return nullptr;
+        }
+        m_cachedChunks.fetch_add(magazine.m_numberOfIndices, std::memory_order_relaxed);
+    }
+
+    --magazine.m_numberOfIndices;
+    m_cachedChunks.fetch_sub(1U, std::memory_order_relaxed);
+    return acquireChunk(magazine.m_indices[magazine.m_numberOfIndices]);
+}
+
+void MemPool::releaseMagazine(MemPoolMagazine& magazine) noexcept
+{
+    if (magazine.m_refillInProgress)
+    {
+        // the owner terminated during the refill; the stored indices were already taken from the free list but
+        // might not be marked as acquired yet and the cached chunk counter was not increased
+        m_freeIndices.completePopBatch(magazine.m_indices, magazine.m_numberOfIndices);
+        m_cachedChunks.fetch_add(magazine.m_numberOfIndices, std::memory_order_relaxed);
+        magazine.m_refillInProgress = false;
+    }
+
+    if (!m_freeIndices.pushBatch(magazine.m_indices, magazine.m_numberOfIndices))
+    {
+        errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+    m_cachedChunks.fetch_sub(magazine.m_numberOfIndices, std::memory_order_relaxed);
+    if (magazine.m_numberOfIndices != 0U)
+    {
+        notifyAllWaiters();
+    }
+    magazine.m_numberOfIndices = 0U;
 }
 
 void MemPool::freeChunk(const void* chunk) noexcept
 {
+    if (hasMultipleChunkSizes())
+    {
+        freeBuddy(chunk);
+        return;
+    }
+
     cxx::Expects(m_rawMemory <= chunk
                  && chunk <= m_rawMemory + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1U)));
 
@@ -109,6 +253,115 @@ void MemPool::freeChunk(const void* chunk) noexcept
     }
 
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
+    notifyWaiter();
+}
+
+void MemPool::freeBuddy(const void* chunk) noexcept
+{
+    const uint32_t minChunkSize = getMinChunkSize();
+    cxx::Expects(m_rawMemory <= chunk
+                 && chunk <= m_rawMemory + (static_cast<uint64_t>(minChunkSize) * (numberOfSmallestChunks() - 1U)));
+
+    auto offset = static_cast<const uint8_t*>(chunk) - m_rawMemory;
+    cxx::Expects(offset % minChunkSize == 0);
+
+    uint32_t index = static_cast<uint32_t>(offset / minChunkSize);
+    const uint32_t order = m_freeBuddies.orderOf(index);
+
+    if (order >= m_numberOfChunkSizes || !m_freeBuddies.push(index))
+    {
+        errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+        return;
+    }
+
+    m_usedChunks.fetch_sub(1U << order, std::memory_order_relaxed);
+    notifyWaiter();
+}
+
+void MemPool::addInternalFragmentation(const uint32_t unusedBytes) noexcept
+{
+    m_internalFragmentation.fetch_add(unusedBytes, std::memory_order_relaxed);
+}
+
+void MemPool::removeInternalFragmentation(const uint32_t unusedBytes) noexcept
+{
+    m_internalFragmentation.fetch_sub(unusedBytes, std::memory_order_relaxed);
+}
+
+void MemPool::storeMax(std::atomic<uint32_t>& value, const uint32_t newValue) noexcept
+{
+    uint32_t currentValue = value.load(std::memory_order_relaxed);
+    while (currentValue < newValue
+           && !value.compare_exchange_weak(currentValue, newValue, std::memory_order_relaxed))
+    {
+    }
+}
+
+void MemPool::addToHistogram(const uint32_t bin, const uint32_t requiredChunkSize) noexcept
+{
+    cxx::Expects(bin < NUMBER_OF_MEMPOOL_HISTOGRAM_BINS && "Histogram bin exceeds limits!");
+    auto& histogramBin = m_histogram[bin];
+    histogramBin.m_numberOfRequests.fetch_add(1U, std::memory_order_relaxed);
+    storeMax(histogramBin.m_maxRequestedChunkSize, requiredChunkSize);
+    storeMax(histogramBin.m_peakUsedChunks, histogramBin.m_usedChunks.fetch_add(1U, std::memory_order_relaxed) + 1U);
+}
+
+void MemPool::removeFromHistogram(const uint32_t bin) noexcept
+{
+    cxx::Expects(bin < NUMBER_OF_MEMPOOL_HISTOGRAM_BINS && "Histogram bin exceeds limits!");
+    m_histogram[bin].m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+void MemPool::addWaiter() noexcept
+{
+    m_numberOfWaiters.fetch_add(1U, std::memory_order_relaxed);
+    // pairs with the fence in notifyWaiter; either the waiter sees the freed chunk when it checks the free chunks
+    // again or the notifier sees the waiter
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void MemPool::removeWaiter() noexcept
+{
+    m_numberOfWaiters.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+bool MemPool::waitForFreedChunk(const units::Duration& timeout) noexcept
+{
+    if (timeout == units::Duration::max())
+    {
+        return !m_freedChunkSemaphore.wait().has_error();
+    }
+
+    auto waitResult = m_freedChunkSemaphore.timedWait(timeout);
+    return !waitResult.has_error() && waitResult.value() == posix::SemaphoreWaitState::NO_TIMEOUT;
+}
+
+void MemPool::notifyWaiter() noexcept
+{
+    // the waiters for the chunks of an extension wait at the corresponding mempool of the configured segment
+    MemPool& notifiedMemPool = (m_notifiedMemPool.get() != nullptr) ? *m_notifiedMemPool : *this;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (notifiedMemPool.m_numberOfWaiters.load(std::memory_order_relaxed) > 0U)
+    {
+        // a failed post means that the semaphore value overflowed, the waiters are woken up nevertheless
+        IOX_DISCARD_RESULT(notifiedMemPool.m_freedChunkSemaphore.post());
+    }
+}
+
+void MemPool::notifyAllWaiters() noexcept
+{
+    MemPool& notifiedMemPool = (m_notifiedMemPool.get() != nullptr) ? *m_notifiedMemPool : *this;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const uint32_t numberOfWaiters = notifiedMemPool.m_numberOfWaiters.load(std::memory_order_relaxed);
+    for (uint32_t i = 0U; i < numberOfWaiters; ++i)
+    {
+        IOX_DISCARD_RESULT(notifiedMemPool.m_freedChunkSemaphore.post());
+    }
+}
+
+void MemPool::forwardNotificationsTo(MemPool& memPool) noexcept
+{
+    m_notifiedMemPool = &memPool;
 }
 
 uint32_t MemPool::getChunkSize() const noexcept
@@ -116,6 +369,11 @@ uint32_t MemPool::getChunkSize() const noexcept
     return m_chunkSize;
 }
 
+uint32_t MemPool::getMinChunkSize() const noexcept
+{
+    return m_chunkSize >> (m_numberOfChunkSizes - 1U);
+}
+
 uint32_t MemPool::getChunkCount() const noexcept
 {
     return m_numberOfChunks;
@@ -131,12 +389,39 @@ uint32_t MemPool::getMinFree() const noexcept
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint32_t MemPool::getCachedChunks() const noexcept
+{
+    return m_cachedChunks.load(std::memory_order_relaxed);
+}
+
+uint32_t MemPool::getMagazineCapacity() const noexcept
+{
+    return m_magazineCapacity;
+}
+
+uint64_t MemPool::getInternalFragmentation() const noexcept
+{
+    return m_internalFragmentation.load(std::memory_order_relaxed);
+}
+
 MemPoolInfo MemPool::getInfo() const noexcept
 {
-    return {m_usedChunks.load(std::memory_order_relaxed),
-            m_minFree.load(std::memory_order_relaxed),
-            m_numberOfChunks,
-            m_chunkSize};
+    // the chunks of a mempool with multiple chunk sizes are counted in chunks of the smallest size
+    MemPoolInfo info{m_usedChunks.load(std::memory_order_relaxed),
+                     m_minFree.load(std::memory_order_relaxed),
+                     numberOfSmallestChunks(),
+                     getMinChunkSize(),
+                     m_cachedChunks.load(std::memory_order_relaxed)};
+    info.m_maxChunkSize = m_chunkSize;
+    info.m_internalFragmentation = m_internalFragmentation.load(std::memory_order_relaxed);
+    for (uint32_t bin = 0U; bin < NUMBER_OF_MEMPOOL_HISTOGRAM_BINS; ++bin)
+    {
+        info.m_histogram[bin].m_numberOfRequests = m_histogram[bin].m_numberOfRequests.load(std::memory_order_relaxed);
+        info.m_histogram[bin].m_maxRequestedChunkSize =
+            m_histogram[bin].m_maxRequestedChunkSize.load(std::memory_order_relaxed);
+        info.m_histogram[bin].m_peakUsedChunks = m_histogram[bin].m_peakUsedChunks.load(std::memory_order_relaxed);
+    }
+    return info;
 }
 
 } // namespace mepoo
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -36,24 +37,53 @@ void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
     for (auto& l_mempool : m_memPoolVector)
     {
-        log << "  MemPool [ ChunkSize = " << l_mempool.getChunkSize()
-            << ", ChunkPayloadSize = " << l_mempool.getChunkSize() - sizeof(ChunkHeader)
-            << ", ChunkCount = " << l_mempool.getChunkCount() << " ]";
+        log << "  MemPool [ ChunkSize = " << availableChunkSize(l_mempool)
+            << ", ChunkPayloadSize = " << availableChunkSize(l_mempool) - sizeof(ChunkHeader)
+            << ", ChunkCount = " << l_mempool.getChunkCount();
+        if (l_mempool.getMinChunkSize() < l_mempool.getChunkSize())
+        {
+            log << ", MinChunkSize = " << l_mempool.getMinChunkSize() - m_chunkManagementPrefixSize;
+        }
+        log << " ]";
     }
 }
 
 void MemoryManager::addMemPool(posix::Allocator& managementAllocator,
                                posix::Allocator& chunkMemoryAllocator,
                                const cxx::greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                               const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept
+                               const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
+                               const uint32_t magazineCapacity,
+                               const uint32_t minChunkPayloadSize) noexcept
 {
     uint32_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint32_t>(chunkPayloadSize));
+    uint32_t numberOfChunkSizes{1U};
+    const uint64_t requiredMemPoolChunkSize = MemoryManager::memPoolChunkSize(
+        {chunkPayloadSize, numberOfChunks, magazineCapacity, minChunkPayloadSize},
+        m_chunkManagementPrefixSize,
+        numberOfChunkSizes);
+    uint32_t adjustedMagazineCapacity = magazineCapacity;
+    if (numberOfChunkSizes > 1U && magazineCapacity > 0U)
+    {
+        LogWarn() << "The MemPool [ ChunkPayloadSize = " << static_cast<uint32_t>(chunkPayloadSize)
+                  << " ] has multiple chunk sizes which do not support a magazine; the magazine is disabled";
+        adjustedMagazineCapacity = 0U;
+    }
+
+    if (requiredMemPoolChunkSize > std::numeric_limits<uint32_t>::max())
+    {
+        LogFatal() << "The MemPool [ ChunkPayloadSize = " << static_cast<uint32_t>(chunkPayloadSize)
+                   << ", MinChunkPayloadSize = " << minChunkPayloadSize << " ] exceeds the maximum chunk size";
+        errorHandler(Error::kMEPOO__MEMPOOL_CHUNK_SIZE_EXCEEDS_MAX_CHUNK_SIZE);
+        return;
+    }
+    const auto memPoolChunkSize = static_cast<uint32_t>(requiredMemPoolChunkSize);
+
     if (m_denyAddMemPool)
     {
         LogFatal() << "After the generation of the chunk management pool you are not allowed to create new mempools.";
         errorHandler(Error::kMEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL);
     }
-    else if (m_memPoolVector.size() > 0 && adjustedChunkSize <= m_memPoolVector.back().getChunkSize())
+    else if (m_memPoolVector.size() > 0 && memPoolChunkSize <= m_memPoolVector.back().getChunkSize())
     {
         auto log = LogFatal();
         log << "The following mempools were already added to the mempool handler:";
@@ -66,15 +96,168 @@ void MemoryManager::addMemPool(posix::Allocator& managementAllocator,
         errorHandler(Error::kMEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
     }
 
-    m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
-    m_totalNumberOfChunks += numberOfChunks;
+    m_memPoolVector.emplace_back(memPoolChunkSize,
+                                 numberOfChunks,
+                                 managementAllocator,
+                                 chunkMemoryAllocator,
+                                 adjustedMagazineCapacity,
+                                 numberOfChunkSizes);
+    // a split chunk requires a chunk management entry for each of its buddies
+    m_totalNumberOfChunks += static_cast<uint32_t>(numberOfChunks) << (numberOfChunkSizes - 1U);
+    m_maxMagazineCapacity = std::max(m_maxMagazineCapacity, adjustedMagazineCapacity);
+}
+
+uint64_t MemoryManager::memPoolChunkSize(const MePooConfig::Entry& entry,
+                                         const uint32_t prefixSize,
+                                         uint32_t& numberOfChunkSizes) noexcept
+{
+    const uint64_t chunkSize = static_cast<uint64_t>(sizeWithChunkHeaderStruct(entry.m_size)) + prefixSize;
+    numberOfChunkSizes = 1U;
+    if (entry.m_minSize == 0U || entry.m_minSize >= entry.m_size)
+    {
+        return chunkSize;
+    }
+
+    // the smallest chunk must be aligned since the buddies are placed next to each other
+    uint64_t minChunkSize = cxx::align(static_cast<uint64_t>(sizeWithChunkHeaderStruct(entry.m_minSize)) + prefixSize,
+                                       MemPool::CHUNK_MEMORY_ALIGNMENT);
+    while ((minChunkSize << (numberOfChunkSizes - 1U)) < chunkSize
+           && numberOfChunkSizes < concurrent::BuddyFreeList::MAX_NUMBER_OF_ORDERS)
+    {
+        ++numberOfChunkSizes;
+    }
+    if ((minChunkSize << (numberOfChunkSizes - 1U)) < chunkSize)
+    {
+        // the smallest chunk size is increased to not exceed the max number of chunk sizes
+        const uint32_t shift = numberOfChunkSizes - 1U;
+        minChunkSize = cxx::align(static_cast<uint64_t>((chunkSize + (1ULL << shift) - 1U) >> shift),
+                                  MemPool::CHUNK_MEMORY_ALIGNMENT);
+    }
+    return minChunkSize << (numberOfChunkSizes - 1U);
 }
 
 void MemoryManager::generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept
 {
     m_denyAddMemPool = true;
+    if (m_chunkManagementLayout == ChunkManagementLayout::EMBEDDED)
+    {
+        // the ChunkManagement is part of the chunks of the mempools
+        return;
+    }
     uint32_t chunkSize = sizeof(ChunkManagement);
-    m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
+    m_chunkManagementPool.emplace_back(chunkSize,
+                                       requiredNumberOfChunkManagementEntries(m_totalNumberOfChunks, m_maxMagazineCapacity),
+                                       managementAllocator,
+                                       managementAllocator,
+                                       m_maxMagazineCapacity);
+}
+
+uint32_t MemoryManager::requiredNumberOfChunkManagementEntries(const uint32_t totalNumberOfChunks,
+                                                                const uint32_t maxMagazineCapacity) noexcept
+{
+    // every port can cache up to maxMagazineCapacity entries in its magazine; these entries are reserved on top of one
+    // entry per chunk in order to not make the mempools without a magazine run out of chunk management entries
+    return totalNumberOfChunks + MAX_NUMBER_OF_CHUNK_MAGAZINES * maxMagazineCapacity;
+}
+
+uint32_t MemoryManager::sizeClassOf(const uint32_t chunkSize) noexcept
+{
+    // ceil(log2(chunkSize)) is the bit width of 'chunkSize - 1'; the bit width is determined by a binary search with a
+    // fixed number of steps in order to be independent of compiler intrinsics
+    uint32_t value = (chunkSize == 0U) ? 0U : chunkSize - 1U;
+    uint32_t bitWidth{0U};
+    for (uint32_t shift = 16U; shift > 0U; shift >>= 1U)
+    {
+        if (value >= (1U << shift))
+        {
+            value >>= shift;
+            bitWidth += shift;
+        }
+    }
+    // the remaining value is either 0 or 1
+    return bitWidth + value;
+}
+
+uint32_t MemoryManager::sizeBucketOf(const uint32_t chunkSize) noexcept
+{
+    const uint32_t sizeClass = sizeClassOf(chunkSize);
+    if (sizeClass <= SUB_BUCKET_BITS)
+    {
+        // the size class is too small to be split
+        return sizeClass * NUMBER_OF_SUB_BUCKETS_PER_SIZE_CLASS;
+    }
+    // 'chunkSize - 1' is in the range [2^(sizeClass-1), 2^sizeClass - 1]; the bits below the most significant bit
+    // select the sub bucket
+    const uint32_t subBucket =
+        ((chunkSize - 1U) >> (sizeClass - 1U - SUB_BUCKET_BITS)) & (NUMBER_OF_SUB_BUCKETS_PER_SIZE_CLASS - 1U);
+    return sizeClass * NUMBER_OF_SUB_BUCKETS_PER_SIZE_CLASS + subBucket;
+}
+
+uint64_t MemoryManager::smallestChunkSizeOfSizeBucket(const uint32_t sizeBucket) noexcept
+{
+    const uint32_t sizeClass = sizeBucket / NUMBER_OF_SUB_BUCKETS_PER_SIZE_CLASS;
+    const uint64_t subBucket = sizeBucket % NUMBER_OF_SUB_BUCKETS_PER_SIZE_CLASS;
+    if (sizeClass == 0U)
+    {
+        return 0U;
+    }
+    if (sizeClass <= SUB_BUCKET_BITS)
+    {
+        // unused sub buckets of the small size classes share the smallest chunk size of the size class
+        return (1ULL << (sizeClass - 1U)) + 1U;
+    }
+    return ((NUMBER_OF_SUB_BUCKETS_PER_SIZE_CLASS + subBucket) << (sizeClass - 1U - SUB_BUCKET_BITS)) + 1U;
+}
+
+void MemoryManager::generateSizeClassIndex() noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeBucket = 0U; sizeBucket < NUMBER_OF_SIZE_BUCKETS; ++sizeBucket)
+    {
+        const uint64_t smallestChunkSize = smallestChunkSizeOfSizeBucket(sizeBucket);
+        while (memPoolIndex < numberOfMemPools && availableChunkSize(m_memPoolVector[memPoolIndex]) < smallestChunkSize)
+        {
+            ++memPoolIndex;
+        }
+        m_sizeClassIndex[sizeBucket] = static_cast<uint8_t>(memPoolIndex);
+    }
+
+    for (uint32_t i = 0U; i < numberOfMemPools; ++i)
+    {
+        m_memPoolSizeBucket[i] = static_cast<uint8_t>(sizeBucketOf(availableChunkSize(m_memPoolVector[i])));
+    }
+}
+
+uint32_t MemoryManager::histogramBinOf(const uint32_t memPoolIndex, const uint32_t requiredChunkSize) const noexcept
+{
+    // the mempool is the first one which can hold requiredChunkSize, therefore its size bucket is not smaller
+    const uint32_t distance = m_memPoolSizeBucket[memPoolIndex] - sizeBucketOf(requiredChunkSize);
+    return std::min(distance, NUMBER_OF_MEMPOOL_HISTOGRAM_BINS - 1U);
+}
+
+uint32_t MemoryManager::findMemPoolIndex(const uint32_t requiredChunkSize) const noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    const uint32_t sizeBucket = sizeBucketOf(requiredChunkSize);
+    // the first mempool of the next size bucket can hold every chunk size of this size bucket, therefore the fitting
+    // mempool is in the range [first, last]; the range is bisected in order to bound the lookup also when many
+    // mempools are within the same size bucket
+    uint32_t first = m_sizeClassIndex[sizeBucket];
+    uint32_t last = (sizeBucket + 1U < NUMBER_OF_SIZE_BUCKETS) ? m_sizeClassIndex[sizeBucket + 1U] : numberOfMemPools;
+    while (first < last)
+    {
+        const uint32_t middle = first + (last - first) / 2U;
+        if (availableChunkSize(m_memPoolVector[middle]) < requiredChunkSize)
+        {
+            first = middle + 1U;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    return first;
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
@@ -88,7 +271,11 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
     {
         return {0, 0, 0, 0};
     }
-    return m_memPoolVector[index].getInfo();
+    // the introspection reports the chunk size without the embedded ChunkManagement
+    auto info = m_memPoolVector[index].getInfo();
+    info.m_chunkSize = m_memPoolVector[index].getMinChunkSize() - m_chunkManagementPrefixSize;
+    info.m_maxChunkSize = availableChunkSize(m_memPoolVector[index]);
+    return info;
 }
 
 uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
@@ -96,17 +283,30 @@ uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t si
     return size + static_cast<uint32_t>(sizeof(ChunkHeader));
 }
 
+uint32_t MemoryManager::chunkManagementPrefixSize(const ChunkManagementLayout layout) noexcept
+{
+    return (layout == ChunkManagementLayout::EMBEDDED) ? EMBEDDED_CHUNK_MANAGEMENT_SIZE : 0U;
+}
+
+uint32_t MemoryManager::availableChunkSize(const MemPool& memPool) const noexcept
+{
+    return memPool.getChunkSize() - m_chunkManagementPrefixSize;
+}
+
 uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept
 {
     uint64_t memorySize{0};
+    const uint32_t prefixSize = chunkManagementPrefixSize(mePooConfig.m_chunkManagementLayout);
     for (const auto& mempoolConfig : mePooConfig.m_mempoolConfig)
     {
         // for the required chunk memory size only the size of the ChunkHeader
         // and the the chunk-payload size is taken into account;
         // the user has the option to further partition the chunk-payload with
-        // a user-header and therefore reduce the user-payload size
+        // a user-header and therefore reduce the user-payload size;
+        // an embedded ChunkManagement is stored in front of the ChunkHeader
+        uint32_t numberOfChunkSizes{1U};
         memorySize += cxx::align(static_cast<uint64_t>(mempoolConfig.m_chunkCount)
-                                     * MemoryManager::sizeWithChunkHeaderStruct(mempoolConfig.m_size),
+                                     * MemoryManager::memPoolChunkSize(mempoolConfig, prefixSize, numberOfChunkSizes),
                                  MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
     return memorySize;
@@ -116,18 +316,43 @@ uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooCon
 {
     uint64_t memorySize{0U};
     uint32_t sumOfAllChunks{0U};
+    uint32_t maxMagazineCapacity{0U};
+    const uint32_t prefixSize = chunkManagementPrefixSize(mePooConfig.m_chunkManagementLayout);
     for (const auto& mempool : mePooConfig.m_mempoolConfig)
     {
+        uint32_t numberOfChunkSizes{1U};
+        MemoryManager::memPoolChunkSize(mempool, prefixSize, numberOfChunkSizes);
+        if (numberOfChunkSizes > 1U)
+        {
+            // every buddy of a split chunk requires a chunk management entry; mempools with multiple chunk sizes
+            // have no magazine
+            sumOfAllChunks += mempool.m_chunkCount << (numberOfChunkSizes - 1U);
+            memorySize += cxx::align(
+                concurrent::BuddyFreeList::requiredMemorySize(mempool.m_chunkCount, numberOfChunkSizes),
+                MemPool::CHUNK_MEMORY_ALIGNMENT);
+            continue;
+        }
+
         sumOfAllChunks += mempool.m_chunkCount;
+        maxMagazineCapacity = std::max(maxMagazineCapacity, mempool.m_magazineCapacity);
         memorySize +=
             cxx::align(static_cast<uint64_t>(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount)),
                        MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
 
-    memorySize +=
-        cxx::align(static_cast<uint64_t>(sumOfAllChunks * sizeof(ChunkManagement)), MemPool::CHUNK_MEMORY_ALIGNMENT);
-    memorySize += cxx::align(static_cast<uint64_t>(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks)),
+    if (mePooConfig.m_chunkManagementLayout == ChunkManagementLayout::EMBEDDED)
+    {
+        // there is no chunk management pool
+        return memorySize;
+    }
+
+    const uint32_t numberOfChunkManagementEntries =
+        requiredNumberOfChunkManagementEntries(sumOfAllChunks, maxMagazineCapacity);
+    memorySize += cxx::align(static_cast<uint64_t>(numberOfChunkManagementEntries) * sizeof(ChunkManagement),
                              MemPool::CHUNK_MEMORY_ALIGNMENT);
+    memorySize +=
+        cxx::align(static_cast<uint64_t>(MemPool::freeList_t::requiredIndexMemorySize(numberOfChunkManagementEntries)),
+                   MemPool::CHUNK_MEMORY_ALIGNMENT);
 
     return memorySize;
 }
@@ -141,32 +366,167 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
                                            posix::Allocator& managementAllocator,
                                            posix::Allocator& chunkMemoryAllocator) noexcept
 {
+    m_chunkManagementLayout = mePooConfig.m_chunkManagementLayout;
+    m_chunkManagementPrefixSize = chunkManagementPrefixSize(m_chunkManagementLayout);
+
     for (auto entry : mePooConfig.m_mempoolConfig)
     {
-        addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
+        addMemPool(managementAllocator,
+                   chunkMemoryAllocator,
+                   entry.m_size,
+                   entry.m_chunkCount,
+                   entry.m_magazineCapacity,
+                   entry.m_minSize);
     }
 
     generateChunkManagementPool(managementAllocator);
+    generateSizeClassIndex();
 }
 
 SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
 {
+    return getChunk(chunkSettings, nullptr);
+}
+
+SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings, ChunkMagazine& magazine) noexcept
+{
+    return getChunk(chunkSettings, &magazine);
+}
+
+void MemoryManager::releaseChunkMagazine(ChunkMagazine& magazine) noexcept
+{
+    for (uint32_t i = 0U; i < m_memPoolVector.size(); ++i)
+    {
+        m_memPoolVector[i].releaseMagazine(magazine.m_memPoolMagazines[i]);
+    }
+
+    if (!m_chunkManagementPool.empty())
+    {
+        m_chunkManagementPool.front().releaseMagazine(magazine.m_chunkManagementMagazine);
+    }
+}
+
+void MemoryManager::addExtension(MemoryManager& extension) noexcept
+{
+    MemoryManager* lastMemoryManager = this;
+    for (auto next = getExtension(); next != nullptr; next = next->getExtension())
+    {
+        lastMemoryManager = next;
+    }
+
+    // the threads which wait for a chunk are waiting at the mempools of the configured segment
+    const uint64_t numberOfMemPools = std::min(m_memPoolVector.size(), extension.m_memPoolVector.size());
+    for (uint64_t i = 0U; i < numberOfMemPools; ++i)
+    {
+        extension.m_memPoolVector[i].forwardNotificationsTo(m_memPoolVector[i]);
+    }
+
+    // the relative pointer is set before the extension is published to the applications
+    lastMemoryManager->m_extension = &extension;
+    lastMemoryManager->m_hasExtension.store(true, std::memory_order_release);
+
+    for (auto& memPool : m_memPoolVector)
+    {
+        memPool.notifyAllWaiters();
+    }
+}
+
+MemoryManager* MemoryManager::getExtension() const noexcept
+{
+    return m_hasExtension.load(std::memory_order_acquire) ? m_extension.get() : nullptr;
+}
+
+void MemoryManager::addInternalFragmentation(ChunkManagement& chunkManagement) noexcept
+{
+    const auto& chunkHeader = *chunkManagement.m_chunkHeader;
+    chunkManagement.m_internalFragmentation = chunkHeader.chunkSize() - chunkHeader.usedSizeOfChunk();
+    if (chunkManagement.m_internalFragmentation != 0U)
+    {
+        chunkManagement.m_mempool->addInternalFragmentation(chunkManagement.m_internalFragmentation);
+    }
+}
+
+void MemoryManager::addToHistogram(ChunkManagement& chunkManagement,
+                                   const uint32_t histogramBin,
+                                   const uint32_t requiredChunkSize) noexcept
+{
+    chunkManagement.m_histogramBin = static_cast<uint8_t>(histogramBin);
+    chunkManagement.m_mempool->addToHistogram(histogramBin, requiredChunkSize);
+}
+
+SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                    ChunkMagazine& magazine,
+                                    const units::Duration& timeout) noexcept
+{
+    const bool hasTimeout = timeout != units::Duration::max();
+    cxx::DeadlineTimer deadline(hasTimeout ? timeout : units::Duration::zero());
+    while (true)
+    {
+        MemPool* exhaustedMemPool{nullptr};
+        auto chunk = acquireChunk(chunkSettings, &magazine, exhaustedMemPool);
+        if (chunk || exhaustedMemPool == nullptr)
+        {
+            return chunk;
+        }
+
+        // the waiter is registered before the mempools are checked again, otherwise a chunk which is freed in
+        // between would not wake up this thread
+        MemPool& memPool = *exhaustedMemPool;
+        memPool.addWaiter();
+        chunk = acquireChunk(chunkSettings, &magazine, exhaustedMemPool);
+        const bool hasToWait = !chunk && exhaustedMemPool != nullptr;
+        const bool wasChunkFreed =
+            hasToWait && memPool.waitForFreedChunk(hasTimeout ? deadline.remainingTime() : units::Duration::max());
+        memPool.removeWaiter();
+
+        if (!hasToWait || !wasChunkFreed)
+        {
+            return chunk;
+        }
+    }
+}
+
+SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings, ChunkMagazine* const magazine) noexcept
+{
+    MemPool* exhaustedMemPool{nullptr};
+    auto chunk = acquireChunk(chunkSettings, magazine, exhaustedMemPool);
+    if (exhaustedMemPool != nullptr)
+    {
+        auto log = LogError();
+        log << "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
+            << chunkSettings.userPayloadSize();
+        log << "The following mempools are available:";
+        printMemPoolVector(log);
+        log.Flush();
+        errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, nullptr, ErrorLevel::MODERATE);
+    }
+    return chunk;
+}
+
+SharedChunk MemoryManager::acquireChunk(const ChunkSettings& chunkSettings,
+                                        ChunkMagazine* const magazine,
+                                        MemPool*& exhaustedMemPool) noexcept
+{
+    exhaustedMemPool = nullptr;
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint32_t aquiredChunkSize = 0U;
+    uint32_t histogramBin = 0U;
 
-    for (auto& memPool : m_memPoolVector)
+    const uint32_t memPoolIndex = findMemPoolIndex(requiredChunkSize);
+    if (memPoolIndex < m_memPoolVector.size())
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
-        {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
-        }
+        auto& memPool = m_memPoolVector[memPoolIndex];
+        // a mempool with multiple chunk sizes splits its chunks to the smallest fitting chunk size
+        const uint32_t chunkSize = memPool.fittingChunkSize(requiredChunkSize + m_chunkManagementPrefixSize);
+        chunk = (magazine != nullptr && memPool.getMagazineCapacity() > 0U)
+                    ? memPool.getChunk(magazine->m_memPoolMagazines[memPoolIndex])
+                    : memPool.getChunk(chunkSize);
+        memPoolPointer = &memPool;
+        aquiredChunkSize = chunkSize - m_chunkManagementPrefixSize;
+        histogramBin = histogramBinOf(memPoolIndex, requiredChunkSize);
     }
 
     if (m_memPoolVector.size() == 0)
@@ -189,20 +549,54 @@ SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
     }
     else if (chunk == nullptr)
     {
-        auto log = LogError();
-        log << "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
-            << chunkSettings.userPayloadSize();
-        log << "The following mempools are available:";
-        printMemPoolVector(log);
-        log.Flush();
-        errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, nullptr, ErrorLevel::MODERATE);
+        // the extensions added at runtime have the same mempools and are only used when this one is exhausted
+        auto extension = getExtension();
+        if (extension != nullptr)
+        {
+            MemPool* exhaustedExtensionMemPool{nullptr};
+            auto extensionChunk = extension->acquireChunk(chunkSettings, nullptr, exhaustedExtensionMemPool);
+            if (exhaustedExtensionMemPool != nullptr)
+            {
+                exhaustedMemPool = memPoolPointer;
+            }
+            return extensionChunk;
+        }
+
+        exhaustedMemPool = memPoolPointer;
         return SharedChunk(nullptr);
     }
+    else if (m_chunkManagementLayout == ChunkManagementLayout::EMBEDDED)
+    {
+        auto chunkHeaderMemory = static_cast<uint8_t*>(chunk) + m_chunkManagementPrefixSize;
+        auto chunkHeader = new (chunkHeaderMemory) ChunkHeader(aquiredChunkSize, chunkSettings);
+        auto chunkManagement = new (chunk) ChunkManagement(chunkHeader, memPoolPointer);
+        addInternalFragmentation(*chunkManagement);
+        addToHistogram(*chunkManagement, histogramBin, requiredChunkSize);
+        return SharedChunk(chunkManagement);
+    }
     else
     {
+        auto& chunkManagementPool = m_chunkManagementPool.front();
+        // the chunk management entries are only cached for mempools which are configured with a magazine
+        void* chunkManagementMemory = (magazine != nullptr && memPoolPointer->getMagazineCapacity() > 0U)
+                                          ? chunkManagementPool.getChunk(magazine->m_chunkManagementMagazine)
+                                          : chunkManagementPool.getChunk();
+        if (chunkManagementMemory == nullptr)
+        {
+            // the chunk management pool has an entry for every chunk plus the entries which can be cached in the
+            // magazines, therefore this should not happen
+            memPoolPointer->freeChunk(chunk);
+            LogError() << "MemoryManager: unable to acquire a chunk management entry";
+            errorHandler(
+                Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, nullptr, ErrorLevel::MODERATE);
+            return SharedChunk(nullptr);
+        }
+
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+        auto chunkManagement =
+            new (chunkManagementMemory) ChunkManagement(chunkHeader, memPoolPointer, &chunkManagementPool);
+        addInternalFragmentation(*chunkManagement);
+        addToHistogram(*chunkManagement, histogramBin, requiredChunkSize);
         return SharedChunk(chunkManagement);
     }
 }
@@ -19,6 +19,8 @@
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace mepoo
@@ -74,10 +76,18 @@ MePooConfig& MePooConfig::optimize() noexcept
             }
             newEntry.m_size = entry.m_size;
             newEntry.m_chunkCount = entry.m_chunkCount;
+            newEntry.m_magazineCapacity = entry.m_magazineCapacity;
+            newEntry.m_minSize = entry.m_minSize;
         }
         else
         {
             newEntry.m_chunkCount += entry.m_chunkCount;
+            newEntry.m_magazineCapacity = std::max(newEntry.m_magazineCapacity, entry.m_magazineCapacity);
+            // a min size of 0 means that the chunks are not split
+            if (newEntry.m_minSize == 0U || (entry.m_minSize != 0U && entry.m_minSize < newEntry.m_minSize))
+            {
+                newEntry.m_minSize = entry.m_minSize;
+            }
         }
     }
 
@@ -21,6 +21,8 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t SegmentGrowth::DEFAULT_HIGH_WATER_MARK;
+
 SegmentConfig& SegmentConfig::setDefaults() noexcept
 {
     auto groupName = posix::PosixGroup::getGroupOfCurrentProcess().getName();
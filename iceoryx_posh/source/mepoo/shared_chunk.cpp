@@ -61,8 +61,25 @@ void SharedChunk::decrementReferenceCounter() noexcept
 
 void SharedChunk::freeChunk() noexcept
 {
-    m_chunkManagement->m_mempool->freeChunk(m_chunkManagement->m_chunkHeader);
-    m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    if (m_chunkManagement->m_internalFragmentation != 0U)
+    {
+        m_chunkManagement->m_mempool->removeInternalFragmentation(m_chunkManagement->m_internalFragmentation);
+    }
+    if (m_chunkManagement->m_histogramBin != ChunkManagement::NO_HISTOGRAM_BIN)
+    {
+        m_chunkManagement->m_mempool->removeFromHistogram(m_chunkManagement->m_histogramBin);
+    }
+
+    if (m_chunkManagement->isEmbedded())
+    {
+        // the embedded ChunkManagement is located at the start of the chunk
+        m_chunkManagement->m_mempool->freeChunk(m_chunkManagement);
+    }
+    else
+    {
+        m_chunkManagement->m_mempool->freeChunk(m_chunkManagement->m_chunkHeader);
+        m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    }
     m_chunkManagement = nullptr;
 }
 
@@ -31,6 +31,8 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
           memoryManager, publisherOptions.subscriberTooSlowPolicy, publisherOptions.historyCapacity, memoryInfo)
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
+    m_chunkSenderData.m_memPoolExhaustedPolicy = publisherOptions.memPoolExhaustedPolicy;
+    m_chunkSenderData.m_loanTimeout = publisherOptions.loanTimeout;
 }
 
 } // namespace popo
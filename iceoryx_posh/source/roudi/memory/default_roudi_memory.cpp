@@ -45,9 +45,15 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexce
     // which are caching different samples; could probably be reduced to 2 with the instruction to not cache the
     // introspection samples
     constexpr uint32_t CHUNK_COUNT{10U};
+    // the mempool statistics are large and only read by tools which take single samples; one chunk is kept as
+    // history, one is held by the subscriber and one is written by RouDi
+    constexpr uint32_t STATISTICS_CHUNK_COUNT{3U};
     mepoo::MePooConfig mempoolConfig;
     mempoolConfig.m_mempoolConfig.push_back(
         {cxx::align(static_cast<uint32_t>(sizeof(roudi::MemPoolIntrospectionInfoContainer)), ALIGNMENT), CHUNK_COUNT});
+    mempoolConfig.m_mempoolConfig.push_back(
+        {cxx::align(static_cast<uint32_t>(sizeof(roudi::MemPoolStatisticsInfoContainer)), ALIGNMENT),
+         STATISTICS_CHUNK_COUNT});
     mempoolConfig.m_mempoolConfig.push_back(
         {cxx::align(static_cast<uint32_t>(sizeof(roudi::ProcessIntrospectionFieldTopic)), ALIGNMENT), CHUNK_COUNT});
     mempoolConfig.m_mempoolConfig.push_back(
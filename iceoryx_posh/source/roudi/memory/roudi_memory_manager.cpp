@@ -21,6 +21,8 @@
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/roudi/memory/memory_provider.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace roudi
@@ -69,6 +71,8 @@ cxx::expected<RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMemo
         return cxx::error<RouDiMemoryManagerError>(RouDiMemoryManagerError::NO_MEMORY_PROVIDER_PRESENT);
     }
 
+    auto creationStart = std::chrono::steady_clock::now();
+
     for (auto memoryProvider : m_memoryProvider)
     {
         auto result = memoryProvider->create();
@@ -85,6 +89,11 @@ cxx::expected<RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMemo
         memoryProvider->announceMemoryAvailable();
     }
 
+    // the payload segments are created and provisioned when the memory is announced
+    auto creationDuration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - creationStart);
+    LogInfo() << "Creating and provisioning the shared memory took " << creationDuration.count() << " ms";
+
     return cxx::success<>();
 }
 
@@ -0,0 +1,132 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi/mempool_config_generator.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace iox
+{
+namespace roudi
+{
+constexpr uint32_t MemPoolConfigGenerator::DEFAULT_HEADROOM_PERCENT;
+
+MemPoolConfigGenerator::MemPoolConfigGenerator(const uint32_t headroomPercent) noexcept
+    : m_headroomPercent(headroomPercent)
+{
+}
+
+uint32_t MemPoolConfigGenerator::chunkCountWithHeadroom(const uint32_t peakUsedChunks) const noexcept
+{
+    constexpr uint64_t PERCENT{100U};
+    const uint64_t chunkCount =
+        (static_cast<uint64_t>(peakUsedChunks) * (PERCENT + m_headroomPercent) + PERCENT - 1U) / PERCENT;
+    return static_cast<uint32_t>(
+        std::min(std::max(chunkCount, static_cast<uint64_t>(1U)),
+                 static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())));
+}
+
+void MemPoolConfigGenerator::mergeEqualSizes(Candidates_t& candidates) noexcept
+{
+    uint64_t last{0U};
+    for (uint64_t i = 1U; i < candidates.size(); ++i)
+    {
+        if (candidates[i].m_size == candidates[last].m_size)
+        {
+            candidates[last].m_chunkCount += candidates[i].m_chunkCount;
+        }
+        else
+        {
+            ++last;
+            candidates[last] = candidates[i];
+        }
+    }
+    while (candidates.size() > last + 1U)
+    {
+        candidates.pop_back();
+    }
+}
+
+void MemPoolConfigGenerator::mergeCheapestNeighbours(Candidates_t& candidates) noexcept
+{
+    // the chunks of the smaller mempool are moved to the larger one, which wastes the difference of the sizes for
+    // each of these chunks
+    uint64_t cheapest{0U};
+    uint64_t lowestCost{std::numeric_limits<uint64_t>::max()};
+    for (uint64_t i = 0U; i + 1U < candidates.size(); ++i)
+    {
+        const uint64_t cost =
+            static_cast<uint64_t>(candidates[i + 1U].m_size - candidates[i].m_size) * candidates[i].m_chunkCount;
+        if (cost < lowestCost)
+        {
+            lowestCost = cost;
+            cheapest = i;
+        }
+    }
+    candidates[cheapest + 1U].m_chunkCount += candidates[cheapest].m_chunkCount;
+    candidates.erase(candidates.begin() + cheapest);
+}
+
+mepoo::MePooConfig MemPoolConfigGenerator::generate(const MemPoolStatisticsInfo& statistics) const noexcept
+{
+    constexpr auto ALIGNMENT = static_cast<uint32_t>(mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT);
+
+    Candidates_t candidates;
+    for (const auto& mempool : statistics.m_mempoolStatistics)
+    {
+        for (const auto& bin : mempool.m_histogram)
+        {
+            if (bin.m_numberOfRequests == 0U)
+            {
+                continue;
+            }
+            const uint32_t chunkPayloadSize = cxx::align(std::max(bin.m_maxRequestedChunkPayloadSize, 1U), ALIGNMENT);
+            candidates.emplace_back(chunkPayloadSize, chunkCountWithHeadroom(bin.m_peakUsedChunks));
+        }
+    }
+
+    mepoo::MePooConfig config;
+    if (candidates.empty())
+    {
+        // without any request there is nothing the mempools could be optimized for
+        for (const auto& mempool : statistics.m_mempoolStatistics)
+        {
+            config.m_mempoolConfig.emplace_back(mempool.m_chunkPayloadSize, mempool.m_numChunks);
+        }
+        return config;
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.m_size < rhs.m_size;
+    });
+    mergeEqualSizes(candidates);
+    while (candidates.size() > MAX_NUMBER_OF_MEMPOOLS)
+    {
+        mergeCheapestNeighbours(candidates);
+    }
+
+    for (const auto& entry : candidates)
+    {
+        config.m_mempoolConfig.emplace_back(entry);
+    }
+    return config;
+}
+
+} // namespace roudi
+} // namespace iox
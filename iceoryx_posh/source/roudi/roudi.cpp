@@ -59,6 +59,8 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
         m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService, IPC_CHANNEL_ROUDI_NAME)));
     m_prcMgr->initIntrospection(&m_processIntrospection);
     m_processIntrospection.run();
+    m_mempoolIntrospection.registerStatisticsPublisherPort(PublisherPortUserType(
+        m_prcMgr->addIntrospectionPublisherPort(IntrospectionMemPoolStatisticsService, IPC_CHANNEL_ROUDI_NAME)));
     m_mempoolIntrospection.run();
 
     // since RouDi offers the introspection services, also add it to the list of processes
@@ -154,6 +156,10 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
     {
         m_prcMgr->run();
 
+        // the segments are extended before their mempools run out of chunks
+        m_roudiMemoryInterface->segmentManager().and_then(
+            [](auto& segmentManager) { segmentManager->extendSegmentsAboveHighWaterMark(); });
+
         cyclicUpdateHook();
 
         std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.toMilliseconds()));
@@ -229,7 +235,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     }
     case runtime::IpcMessageType::CREATE_PUBLISHER:
     {
-        if (message.getNumberOfElements() != 8)
+        if (message.getNumberOfElements() != 10)
         {
             LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_PUBLISHER\" from \"" << runtimeName
                        << "\"received!";
@@ -237,7 +243,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
-            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(7));
+            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(9));
 
             if (!service.isValid())
             {
@@ -274,6 +280,27 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             }
             options.subscriberTooSlowPolicy = static_cast<popo::SubscriberTooSlowPolicy>(subscriberTooSlowPolicy);
 
+            uint8_t memPoolExhaustedPolicy{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(7).c_str(), memPoolExhaustedPolicy))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
+                           << message.getElementAtIndex(7).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.memPoolExhaustedPolicy = static_cast<popo::MemPoolExhaustedPolicy>(memPoolExhaustedPolicy);
+
+            int64_t loanTimeoutNanoseconds{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(8).c_str(), loanTimeoutNanoseconds))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
+                           << message.getElementAtIndex(8).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            // a negative timeout represents the infinite timeout
+            options.loanTimeout = (loanTimeoutNanoseconds < 0)
+                                      ? units::Duration::max()
+                                      : units::Duration::fromNanoseconds(loanTimeoutNanoseconds);
+
             m_prcMgr->addPublisherForProcess(
                 runtimeName, service, options, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
@@ -109,11 +109,120 @@ TomlRouDiConfigFileProvider::parse() noexcept
     }
 
     iox::RouDiConfig_t parsedConfig;
+    uint64_t numberOfSegments{segments->get().size()};
     for (auto segment : *segments)
     {
         auto writer = segment->get_as<std::string>("writer").value_or(groupOfCurrentProcess);
         auto reader = segment->get_as<std::string>("reader").value_or(groupOfCurrentProcess);
         iox::mepoo::MePooConfig mempoolConfig;
+        auto chunkManagementLayout = segment->get_as<std::string>("chunk-management").value_or("mempool");
+        if (chunkManagementLayout == "embedded")
+        {
+            // the reference counter is located in the payload segment which is mapped read-only for the readers
+            if (reader != writer)
+            {
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::EMBEDDED_CHUNK_MANAGEMENT_WITH_DIFFERENT_READER_AND_WRITER_GROUP);
+            }
+            mempoolConfig.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::EMBEDDED;
+        }
+        else if (chunkManagementLayout != "mempool")
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_CHUNK_MANAGEMENT_LAYOUT);
+        }
+
+        uint64_t hugePageSize{iox::posix::SharedMemory::NO_HUGE_PAGES};
+        auto hugePages = segment->get_as<std::string>("huge-pages").value_or("none");
+        if (hugePages == "2M")
+        {
+            hugePageSize = 2U * 1024U * 1024U;
+        }
+        else if (hugePages == "1G")
+        {
+            hugePageSize = 1024U * 1024U * 1024U;
+        }
+        else if (hugePages != "none")
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_SIZE);
+        }
+
+        iox::posix::SharedMemoryProvisioning provisioning;
+        auto prefault = segment->get_as<std::string>("prefault").value_or("none");
+        if (prefault == "touch")
+        {
+            provisioning.m_prefaultMode = iox::posix::PrefaultMode::TOUCH_PAGES;
+        }
+        else if (prefault == "populate")
+        {
+            provisioning.m_prefaultMode = iox::posix::PrefaultMode::POPULATE;
+        }
+        else if (prefault != "none")
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_PREFAULT_MODE);
+        }
+        provisioning.m_lockPages = segment->get_as<bool>("lock-pages").value_or(false);
+        provisioning.m_skipZeroing = segment->get_as<bool>("skip-zeroing").value_or(false);
+        provisioning.m_numberOfWorkerThreads = segment->get_as<uint32_t>("provisioning-threads").value_or(1U);
+
+        auto numaPolicy = segment->get_as<std::string>("numa-policy").value_or("default");
+        if (numaPolicy == "bind")
+        {
+            provisioning.m_numaPolicy = iox::posix::NumaPolicy::BIND;
+        }
+        else if (numaPolicy == "interleave")
+        {
+            provisioning.m_numaPolicy = iox::posix::NumaPolicy::INTERLEAVE;
+        }
+        else if (numaPolicy == "preferred")
+        {
+            provisioning.m_numaPolicy = iox::posix::NumaPolicy::PREFERRED;
+        }
+        else if (numaPolicy != "default")
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_POLICY);
+        }
+
+        auto numaNodes = segment->get_array_of<int64_t>("numa-nodes");
+        if (numaNodes)
+        {
+            for (auto node : *numaNodes)
+            {
+                constexpr auto MAX_NUMA_NODES = iox::posix::SharedMemoryProvisioning::MAX_NUMBER_OF_NUMA_NODES;
+                if (node < 0 || node >= static_cast<int64_t>(MAX_NUMA_NODES))
+                {
+                    return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                        iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES);
+                }
+                provisioning.m_numaNodeMask |= (1ULL << static_cast<uint64_t>(node));
+            }
+        }
+        if (provisioning.m_numaPolicy != iox::posix::NumaPolicy::DEFAULT && provisioning.m_numaNodeMask == 0U)
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES);
+        }
+
+        iox::mepoo::SegmentGrowth growth;
+        growth.m_maxExtensions = segment->get_as<uint32_t>("max-extensions").value_or(0U);
+        growth.m_highWaterMark =
+            segment->get_as<uint32_t>("high-water-mark").value_or(iox::mepoo::SegmentGrowth::DEFAULT_HIGH_WATER_MARK);
+        if (growth.m_highWaterMark == 0U || growth.m_highWaterMark > 100U)
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_HIGH_WATER_MARK);
+        }
+        // every extension is an additional shared memory segment
+        numberOfSegments += growth.m_maxExtensions;
+        if (numberOfSegments > iox::MAX_SHM_SEGMENTS)
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_SEGMENTS_EXCEEDED);
+        }
+
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -131,6 +240,8 @@ TomlRouDiConfigFileProvider::parse() noexcept
         {
             auto chunkSize = mempool->get_as<uint32_t>("size");
             auto chunkCount = mempool->get_as<uint32_t>("count");
+            auto magazineCapacity = mempool->get_as<uint32_t>("magazine").value_or(0U);
+            auto minChunkSize = mempool->get_as<uint32_t>("min-size");
             if (!chunkSize)
             {
                 return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
@@ -141,12 +252,31 @@ TomlRouDiConfigFileProvider::parse() noexcept
                 return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
                     iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT);
             }
-            mempoolConfig.addMemPool({*chunkSize, *chunkCount});
+            if (magazineCapacity > iox::MAX_CHUNK_MAGAZINE_CAPACITY)
+            {
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::MEMPOOL_MAGAZINE_CAPACITY_EXCEEDED);
+            }
+            if (minChunkSize && (*minChunkSize == 0U || *minChunkSize >= *chunkSize))
+            {
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_MIN_SIZE);
+            }
+            if (minChunkSize && magazineCapacity > 0U)
+            {
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::MEMPOOL_MAGAZINE_WITH_MIN_SIZE);
+            }
+            mempoolConfig.addMemPool({*chunkSize, *chunkCount, magazineCapacity, minChunkSize.value_or(0U)});
         }
         parsedConfig.m_sharedMemorySegments.push_back(
             {iox::posix::PosixGroup::string_t(iox::cxx::TruncateToCapacity, reader),
              iox::posix::PosixGroup::string_t(iox::cxx::TruncateToCapacity, writer),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             hugePageSize,
+             provisioning,
+             growth});
     }
 
     return iox::cxx::success<iox::RouDiConfig_t>(parsedConfig);
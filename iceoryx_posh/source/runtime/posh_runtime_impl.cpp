@@ -28,7 +28,9 @@
 #include "iceoryx_posh/runtime/node.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -126,11 +128,22 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         options.nodeName = m_appName;
     }
 
+    // the loan timeout is sent in nanoseconds; a negative value represents the infinite timeout units::Duration::max()
+    // and the finite timeouts are limited since the largest values can not be parsed
+    constexpr int64_t MAX_LOAN_TIMEOUT_NANOSECONDS{std::numeric_limits<int64_t>::max() - 1};
+    const int64_t loanTimeoutNanoseconds =
+        (options.loanTimeout == units::Duration::max())
+            ? -1
+            : static_cast<int64_t>(std::min(options.loanTimeout.toNanoseconds(),
+                                            static_cast<uint64_t>(MAX_LOAN_TIMEOUT_NANOSECONDS)));
+
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
                << static_cast<cxx::Serialization>(service).toString() << cxx::convert::toString(options.historyCapacity)
                << options.nodeName << cxx::convert::toString(options.offerOnCreate)
                << cxx::convert::toString(static_cast<uint8_t>(options.subscriberTooSlowPolicy))
+               << cxx::convert::toString(static_cast<uint8_t>(options.memPoolExhaustedPolicy))
+               << cxx::convert::toString(loanTimeoutNanoseconds)
                << static_cast<cxx::Serialization>(portConfigInfo).toString();
 
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
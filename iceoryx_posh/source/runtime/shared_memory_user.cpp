@@ -18,10 +18,13 @@
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace runtime
@@ -59,29 +62,96 @@ void SharedMemoryUser::openDataSegments(const uint64_t segmentId,
     auto segmentMapping = segmentManager->getSegmentMappings(posix::PosixUser::getUserOfCurrentProcess());
     for (const auto& segment : segmentMapping)
     {
-        auto accessMode = segment.m_isWritable ? posix::AccessMode::READ_WRITE : posix::AccessMode::READ_ONLY;
-        posix::SharedMemoryObject::create(segment.m_sharedMemoryName,
-                                          segment.m_size,
-                                          accessMode,
-                                          posix::OpenMode::OPEN_EXISTING,
-                                          posix::SharedMemoryObject::NO_ADDRESS_HINT)
-            .and_then([this, &segment](auto& sharedMemoryObject) {
+        openDataSegment(segment)
+            .and_then([this](auto& sharedMemoryObject) {
                 if (static_cast<uint32_t>(m_dataShmObjects.size()) >= MAX_SHM_SEGMENTS)
                 {
                     errorHandler(Error::kPOSH__SHM_APP_SEGMENT_COUNT_OVERFLOW);
                 }
 
-                rp::BaseRelativePointer::registerPtr(
-                    segment.m_segmentId, sharedMemoryObject.getBaseAddress(), sharedMemoryObject.getSizeInBytes());
-
-                LogDebug() << "Application registered payload data segment "
-                           << iox::log::HexFormat(reinterpret_cast<uint64_t>(sharedMemoryObject.getBaseAddress()))
-                           << " with size " << sharedMemoryObject.getSizeInBytes() << " to id " << segment.m_segmentId;
-
                 m_dataShmObjects.emplace_back(std::move(sharedMemoryObject));
             })
             .or_else([](auto&) { errorHandler(Error::kPOSH__SHM_APP_SEGMENT_MAPP_ERR); });
     }
+
+    // RouDi can add segments at runtime which are mapped when they are accessed for the first time
+    onDemandSegments().m_segmentManager = segmentManager;
+    rp::BaseRelativePointer::setUnknownIdHandler(&SharedMemoryUser::mapSegmentOnDemand);
+}
+
+cxx::expected<posix::SharedMemoryObject, posix::SharedMemoryObjectError>
+SharedMemoryUser::openDataSegment(const mepoo::SegmentManager<>::SegmentMapping& segment) noexcept
+{
+    auto accessMode = segment.m_isWritable ? posix::AccessMode::READ_WRITE : posix::AccessMode::READ_ONLY;
+    // RouDi reports the page size the segment was actually created with, i.e. after a possible fallback
+    auto hugePageSize =
+        (segment.m_pageSize > posix::pageSize()) ? segment.m_pageSize : posix::SharedMemory::NO_HUGE_PAGES;
+    auto sharedMemoryObject =
+        posix::SharedMemoryObject::create(segment.m_sharedMemoryName,
+                                          segment.m_size,
+                                          accessMode,
+                                          posix::OpenMode::OPEN_EXISTING,
+                                          posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                          static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP),
+                                          hugePageSize);
+    sharedMemoryObject.and_then([&segment](auto& sharedMemoryObject) {
+        rp::BaseRelativePointer::registerPtr(
+            segment.m_segmentId, sharedMemoryObject.getBaseAddress(), sharedMemoryObject.getSizeInBytes());
+
+        LogDebug() << "Application registered payload data segment "
+                   << iox::log::HexFormat(reinterpret_cast<uint64_t>(sharedMemoryObject.getBaseAddress()))
+                   << " with size " << sharedMemoryObject.getSizeInBytes() << " to id " << segment.m_segmentId;
+    });
+    return sharedMemoryObject;
+}
+
+SharedMemoryUser::OnDemandSegments& SharedMemoryUser::onDemandSegments() noexcept
+{
+    static OnDemandSegments onDemandSegments;
+    return onDemandSegments;
+}
+
+void* SharedMemoryUser::mapSegmentOnDemand(const rp::BaseRelativePointer::id_t segmentId) noexcept
+{
+    auto& onDemandSegments = SharedMemoryUser::onDemandSegments();
+    std::lock_guard<std::mutex> lock(onDemandSegments.m_mutex);
+
+    // another thread could have mapped the segment in the meantime
+    for (auto& mappedSegment : onDemandSegments.m_mappedSegments)
+    {
+        if (mappedSegment.m_segmentId == segmentId)
+        {
+            return mappedSegment.m_sharedMemoryObject.getBaseAddress();
+        }
+    }
+
+    if (onDemandSegments.m_segmentManager == nullptr
+        || onDemandSegments.m_mappedSegments.size() >= onDemandSegments.m_mappedSegments.capacity())
+    {
+        return nullptr;
+    }
+
+    auto segmentMapping =
+        onDemandSegments.m_segmentManager->getSegmentMappings(posix::PosixUser::getUserOfCurrentProcess());
+    auto segment = std::find_if(segmentMapping.begin(), segmentMapping.end(), [&](const auto& mapping) {
+        return mapping.m_segmentId == segmentId;
+    });
+    if (segment == segmentMapping.end())
+    {
+        LogError() << "The segment with id " << segmentId << " is not accessible by the application";
+        return nullptr;
+    }
+
+    void* baseAddress{nullptr};
+    openDataSegment(*segment)
+        .and_then([&](auto& sharedMemoryObject) {
+            baseAddress = sharedMemoryObject.getBaseAddress();
+            onDemandSegments.m_mappedSegments.push_back({segmentId, std::move(sharedMemoryObject)});
+        })
+        .or_else([&](auto&) {
+            LogError() << "Unable to map the segment " << segment->m_sharedMemoryName << " with id " << segmentId;
+        });
+    return baseAddress;
 }
 } // namespace runtime
 } // namespace iox
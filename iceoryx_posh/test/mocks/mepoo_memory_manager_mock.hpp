@@ -27,6 +27,10 @@ class MePooMemoryManager_MOCK
         return iox::MAX_NUMBER_OF_MEMPOOLS;
     }
     MOCK_CONST_METHOD1(getMemPoolInfo, iox::mepoo::MemPoolInfo(uint32_t));
+    MePooMemoryManager_MOCK* getExtension() const
+    {
+        return nullptr;
+    }
 };
 
 #endif // IOX_POSH_MOCKS_MEPOO_MEMORY_MANAGER_MOCK_HPP
@@ -20,9 +20,13 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "test.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
+using namespace iox::units::duration_literals;
 
 using iox::mepoo::ChunkHeader;
 using iox::mepoo::ChunkSettings;
@@ -452,6 +456,85 @@ TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(CHUNK_COUNT));
 }
 
+TEST_F(MemoryManager_test, getChunkAcquiresChunkFromSmallestFittingMemPoolForAllUserPayloadSizes)
+{
+    constexpr uint32_t CHUNK_COUNT{1U};
+    // chunk sizes which share size classes and are not aligned to powers of two
+    const std::vector<uint32_t> chunkPayloadSizes{8U, 16U, 24U, 40U, 64U, 72U, 128U, 136U, 520U, 1000U};
+    for (const auto chunkPayloadSize : chunkPayloadSizes)
+    {
+        mempoolconf.addMemPool({chunkPayloadSize, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint32_t userPayloadSize = 0U; userPayloadSize <= chunkPayloadSizes.back(); ++userPayloadSize)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        auto& chunkSettings = chunkSettingsResult.value();
+
+        uint32_t expectedChunkSize{0U};
+        for (const auto chunkPayloadSize : chunkPayloadSizes)
+        {
+            expectedChunkSize = chunkPayloadSize + static_cast<uint32_t>(sizeof(ChunkHeader));
+            if (expectedChunkSize >= chunkSettings.requiredChunkSize())
+            {
+                break;
+            }
+        }
+
+        auto chunk = sut->getChunk(chunkSettings);
+        ASSERT_THAT(chunk, Eq(true));
+        EXPECT_THAT(chunk.getChunkHeader()->chunkSize(), Eq(expectedChunkSize));
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkAcquiresChunkFromSmallestFittingMemPoolWhenAllMemPoolsShareOneSizeBucket)
+{
+    constexpr uint32_t CHUNK_COUNT{1U};
+    constexpr uint32_t SMALLEST_CHUNK_PAYLOAD_SIZE{4096U};
+    constexpr uint32_t CHUNK_PAYLOAD_SIZE_INCREMENT{8U};
+    for (uint32_t i = 0U; i < iox::MAX_NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({SMALLEST_CHUNK_PAYLOAD_SIZE + i * CHUNK_PAYLOAD_SIZE_INCREMENT, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint32_t i = 0U; i < iox::MAX_NUMBER_OF_MEMPOOLS; ++i)
+    {
+        const uint32_t userPayloadSize = SMALLEST_CHUNK_PAYLOAD_SIZE + i * CHUNK_PAYLOAD_SIZE_INCREMENT - 1U;
+        auto chunkSettingsResult = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+
+        auto chunk = sut->getChunk(chunkSettingsResult.value());
+        ASSERT_THAT(chunk, Eq(true));
+        EXPECT_THAT(sut->getMemPoolInfo(i).m_usedChunks, Eq(1U));
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkSizeBetweenLargestMemPoolAndNextSizeClassReturnsError)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_EQ(errorLevel, iox::ErrorLevel::SEVERE);
+        });
+
+    // the largest mempool and the requested chunk are in the same size class
+    auto chunkSettingsResult = ChunkSettings::create(CHUNK_SIZE_64 + 8U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    EXPECT_THAT(sut->getChunk(chunkSettingsResult.value()), Eq(false));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE);
+}
+
 TEST_F(MemoryManager_test, getChunkWithUserPayloadSizeZeroShouldNotFail)
 {
     constexpr uint32_t USER_PAYLOAD_SIZE{0U};
@@ -470,4 +553,496 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     EXPECT_DEATH({ sut->configureMemoryManager(mempoolconf, *allocator, *allocator); }, ".*");
 }
 
-} // namespace
\ No newline at end of file
+TEST_F(MemoryManager_test, getChunkWithMagazineAcquiresAllChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, MAGAZINE_CAPACITY});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine;
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < CHUNK_COUNT; i++)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32, magazine));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, releaseChunkMagazineReturnsCachedChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, MAGAZINE_CAPACITY});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine;
+
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, magazine);
+        ASSERT_THAT(chunk, Eq(true));
+    }
+    sut->releaseChunkMagazine(magazine);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < CHUNK_COUNT; i++)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkWithMagazineWhenOtherMagazineCachesLastChunksReturnsError)
+{
+    constexpr uint32_t CHUNK_COUNT{4U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, MAGAZINE_CAPACITY});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine;
+    iox::mepoo::ChunkMagazine otherMagazine;
+
+    auto chunk = sut->getChunk(chunkSettings_32, magazine);
+    ASSERT_THAT(chunk, Eq(true));
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_EQ(errorLevel, iox::ErrorLevel::MODERATE);
+        });
+
+    EXPECT_THAT(sut->getChunk(chunkSettings_32, otherMagazine), Eq(false));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, getChunkFromMempoolWithoutMagazineSucceedsWhenMagazinesCacheChunkManagementEntries)
+{
+    constexpr uint32_t CHUNK_COUNT{4U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 1U});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, 1U});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT, MAGAZINE_CAPACITY});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    // every magazine caches chunk management entries for the mempool with magazine
+    std::vector<iox::mepoo::ChunkMagazine> magazines(CHUNK_COUNT);
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (auto& magazine : magazines)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32, magazine));
+        ASSERT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    iox::mepoo::ChunkMagazine magazine;
+    EXPECT_THAT(sut->getChunk(chunkSettings_64, magazine), Eq(true));
+    EXPECT_THAT(magazine.m_chunkManagementMagazine.m_numberOfIndices, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getMemPoolInfoContainsCachedChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, MAGAZINE_CAPACITY});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine;
+
+    auto chunk = sut->getChunk(chunkSettings_32, magazine);
+    ASSERT_THAT(chunk, Eq(true));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_cachedChunks, Eq(MAGAZINE_CAPACITY - 1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_minFreeChunks, Eq(CHUNK_COUNT - MAGAZINE_CAPACITY));
+}
+
+TEST_F(MemoryManager_test, requiredManagementMemorySizeWithMagazineReservesChunkManagementEntriesForMagazines)
+{
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    iox::mepoo::MePooConfig magazineMempoolconf;
+    magazineMempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, MAGAZINE_CAPACITY});
+
+    EXPECT_THAT(iox::mepoo::MemoryManager::requiredManagementMemorySize(magazineMempoolconf),
+                Ge(iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolconf)
+                   + iox::MAX_NUMBER_OF_CHUNK_MAGAZINES * MAGAZINE_CAPACITY * sizeof(iox::mepoo::ChunkManagement)));
+}
+
+TEST_F(MemoryManager_test, requiredManagementMemorySizeWithEmbeddedChunkManagementIsSmaller)
+{
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    iox::mepoo::MePooConfig embeddedMempoolconf = mempoolconf;
+    embeddedMempoolconf.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::EMBEDDED;
+
+    EXPECT_THAT(iox::mepoo::MemoryManager::requiredManagementMemorySize(embeddedMempoolconf),
+                Lt(iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolconf)));
+    EXPECT_THAT(iox::mepoo::MemoryManager::requiredChunkMemorySize(embeddedMempoolconf),
+                Gt(iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolconf)));
+}
+
+TEST_F(MemoryManager_test, getChunkWithEmbeddedChunkManagementAcquiresAndReleasesAllChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::EMBEDDED;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    const uint32_t expectedChunkSize = CHUNK_SIZE_32 + static_cast<uint32_t>(sizeof(ChunkHeader));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_chunkSize, Eq(expectedChunkSize));
+
+    {
+        std::vector<iox::mepoo::SharedChunk> chunkStore;
+        for (size_t i = 0; i < CHUNK_COUNT; i++)
+        {
+            chunkStore.push_back(sut->getChunk(chunkSettings_32));
+            ASSERT_THAT(chunkStore.back(), Eq(true));
+            EXPECT_THAT(chunkStore.back().getChunkHeader()->chunkSize(), Eq(expectedChunkSize));
+        }
+        EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkFromMemPoolWithMinSizeAcquiresSmallestFittingChunkSize)
+{
+    constexpr uint32_t CHUNK_COUNT{2U};
+    constexpr uint32_t MAX_CHUNK_PAYLOAD_SIZE{8192U};
+    mempoolconf.addMemPool({MAX_CHUNK_PAYLOAD_SIZE, CHUNK_COUNT, 0U, CHUNK_SIZE_64});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto info = sut->getMemPoolInfo(0U);
+    EXPECT_THAT(info.m_chunkSize, Ge(CHUNK_SIZE_64 + static_cast<uint32_t>(sizeof(ChunkHeader))));
+    EXPECT_THAT(info.m_maxChunkSize, Ge(MAX_CHUNK_PAYLOAD_SIZE + static_cast<uint32_t>(sizeof(ChunkHeader))));
+    EXPECT_THAT(info.m_maxChunkSize % info.m_chunkSize, Eq(0U));
+
+    auto smallChunk = sut->getChunk(chunkSettings_64);
+    ASSERT_THAT(smallChunk, Eq(true));
+    EXPECT_THAT(smallChunk.getChunkHeader()->chunkSize(), Eq(info.m_chunkSize));
+
+    auto largeChunkSettings =
+        iox::mepoo::ChunkSettings::create(MAX_CHUNK_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+    auto largeChunk = sut->getChunk(largeChunkSettings);
+    ASSERT_THAT(largeChunk, Eq(true));
+    EXPECT_THAT(largeChunk.getChunkHeader()->chunkSize(), Eq(info.m_maxChunkSize));
+
+    // the first large chunk is split for the small chunk, therefore the second large chunk is not available anymore
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks,
+                Eq(1U + info.m_maxChunkSize / info.m_chunkSize));
+}
+
+TEST_F(MemoryManager_test, getChunkFromMemPoolWithMinSizeAcquiresAndReleasesAllSmallestChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_256 * 4U, CHUNK_COUNT, 0U, CHUNK_SIZE_32});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    const auto numberOfSmallestChunks = sut->getMemPoolInfo(0U).m_numChunks;
+    ASSERT_THAT(numberOfSmallestChunks, Gt(CHUNK_COUNT));
+
+    {
+        std::vector<iox::mepoo::SharedChunk> chunkStore;
+        for (uint32_t i = 0U; i < numberOfSmallestChunks; ++i)
+        {
+            chunkStore.push_back(sut->getChunk(chunkSettings_32));
+            ASSERT_THAT(chunkStore.back(), Eq(true));
+        }
+        EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(numberOfSmallestChunks));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    auto largeChunkSettings =
+        iox::mepoo::ChunkSettings::create(CHUNK_SIZE_256 * 4U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(largeChunkSettings));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+}
+
+TEST_F(MemoryManager_test, getMemPoolInfoContainsInternalFragmentationOfUsedChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    {
+        auto chunk = sut->getChunk(chunkSettings_32);
+        ASSERT_THAT(chunk, Eq(true));
+        const auto chunkHeader = chunk.getChunkHeader();
+        EXPECT_THAT(sut->getMemPoolInfo(0U).m_internalFragmentation,
+                    Eq(chunkHeader->chunkSize() - chunkHeader->usedSizeOfChunk()));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_internalFragmentation, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithFittingSizeIsAddedToFirstHistogramBin)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunk = sut->getChunk(chunkSettings_128);
+    ASSERT_THAT(chunk, Eq(true));
+
+    const auto histogramBin = sut->getMemPoolInfo(0U).m_histogram[0U];
+    EXPECT_THAT(histogramBin.m_numberOfRequests, Eq(1U));
+    EXPECT_THAT(histogramBin.m_maxRequestedChunkSize, Eq(chunkSettings_128.requiredChunkSize()));
+    EXPECT_THAT(histogramBin.m_peakUsedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithMuchSmallerSizeIsAddedToLastHistogramBin)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_256 * 64U, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunk = sut->getChunk(chunkSettings_32);
+    ASSERT_THAT(chunk, Eq(true));
+
+    const auto memPoolInfo = sut->getMemPoolInfo(0U);
+    EXPECT_THAT(memPoolInfo.m_histogram[iox::NUMBER_OF_MEMPOOL_HISTOGRAM_BINS - 1U].m_numberOfRequests, Eq(1U));
+    EXPECT_THAT(memPoolInfo.m_histogram[iox::NUMBER_OF_MEMPOOL_HISTOGRAM_BINS - 1U].m_maxRequestedChunkSize,
+                Eq(chunkSettings_32.requiredChunkSize()));
+    EXPECT_THAT(memPoolInfo.m_histogram[0U].m_numberOfRequests, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, histogramBinKeepsPeakOfUsedChunksWhenChunksAreReleased)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t PEAK_USED_CHUNKS{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    {
+        std::vector<iox::mepoo::SharedChunk> chunks;
+        for (uint32_t i = 0U; i < PEAK_USED_CHUNKS; ++i)
+        {
+            chunks.push_back(sut->getChunk(chunkSettings_128));
+        }
+    }
+    auto chunk = sut->getChunk(chunkSettings_128);
+    ASSERT_THAT(chunk, Eq(true));
+
+    const auto histogramBin = sut->getMemPoolInfo(0U).m_histogram[0U];
+    EXPECT_THAT(histogramBin.m_numberOfRequests, Eq(PEAK_USED_CHUNKS + 1U));
+    EXPECT_THAT(histogramBin.m_peakUsedChunks, Eq(PEAK_USED_CHUNKS));
+}
+
+TEST_F(MemoryManager_test, histogramBinsOfSmallerRequestsAreLargerAndDisjoint)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunk256 = sut->getChunk(chunkSettings_256);
+    auto chunk64 = sut->getChunk(chunkSettings_64);
+    ASSERT_THAT(chunk256, Eq(true));
+    ASSERT_THAT(chunk64, Eq(true));
+
+    const auto memPoolInfo = sut->getMemPoolInfo(0U);
+    uint32_t binOf64{0U};
+    uint64_t numberOfRequests{0U};
+    for (uint32_t bin = 0U; bin < iox::NUMBER_OF_MEMPOOL_HISTOGRAM_BINS; ++bin)
+    {
+        numberOfRequests += memPoolInfo.m_histogram[bin].m_numberOfRequests;
+        if (memPoolInfo.m_histogram[bin].m_maxRequestedChunkSize == chunkSettings_64.requiredChunkSize())
+        {
+            binOf64 = bin;
+        }
+    }
+    EXPECT_THAT(numberOfRequests, Eq(2U));
+    EXPECT_THAT(memPoolInfo.m_histogram[0U].m_numberOfRequests, Eq(1U));
+    EXPECT_THAT(binOf64, Gt(0U));
+}
+
+TEST_F(MemoryManager_test, requiredMemorySizeWithMinSizeIncludesBuddyFreeListAndChunkManagementForAllSmallestChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_256 * 4U, CHUNK_COUNT});
+    iox::mepoo::MePooConfig minSizeMempoolconf;
+    minSizeMempoolconf.addMemPool({CHUNK_SIZE_256 * 4U, CHUNK_COUNT, 0U, CHUNK_SIZE_32});
+
+    EXPECT_THAT(iox::mepoo::MemoryManager::requiredManagementMemorySize(minSizeMempoolconf),
+                Gt(iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolconf)));
+    EXPECT_THAT(iox::mepoo::MemoryManager::requiredChunkMemorySize(minSizeMempoolconf),
+                Ge(iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolconf)));
+}
+
+TEST_F(MemoryManager_test, getExtensionWithoutExtensionReturnsNullptr)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 1U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    EXPECT_THAT(sut->getExtension(), Eq(nullptr));
+}
+
+TEST_F(MemoryManager_test, addedExtensionsAreChainedInTheOrderOfAddition)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 1U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MemoryManager firstExtension;
+    firstExtension.configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MemoryManager secondExtension;
+    secondExtension.configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    sut->addExtension(firstExtension);
+    sut->addExtension(secondExtension);
+
+    EXPECT_THAT(sut->getExtension(), Eq(&firstExtension));
+    EXPECT_THAT(firstExtension.getExtension(), Eq(&secondExtension));
+    EXPECT_THAT(secondExtension.getExtension(), Eq(nullptr));
+}
+
+TEST_F(MemoryManager_test, getChunkAcquiresChunksFromExtensionWhenMempoolsAreExhausted)
+{
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MemoryManager extension;
+    extension.configureMemoryManager(mempoolconf, *allocator, *allocator);
+    sut->addExtension(extension);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < 2U * CHUNK_COUNT; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32));
+        ASSERT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(extension.getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+
+    chunkStore.clear();
+    EXPECT_THAT(extension.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkPrefersOwnMempoolsOverExtension)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 2U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MemoryManager extension;
+    extension.configureMemoryManager(mempoolconf, *allocator, *allocator);
+    sut->addExtension(extension);
+
+    auto chunk = sut->getChunk(chunkSettings_32);
+    ASSERT_THAT(chunk, Eq(true));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+    EXPECT_THAT(extension.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkFailsWhenMempoolsAndAllExtensionsAreExhausted)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 1U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MemoryManager extension;
+    extension.configureMemoryManager(mempoolconf, *allocator, *allocator);
+    sut->addExtension(extension);
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    auto chunk1 = sut->getChunk(chunkSettings_32);
+    auto chunk2 = sut->getChunk(chunkSettings_32);
+    auto chunk3 = sut->getChunk(chunkSettings_32);
+
+    EXPECT_THAT(chunk1, Eq(true));
+    EXPECT_THAT(chunk2, Eq(true));
+    EXPECT_THAT(chunk3, Eq(false));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, getChunkWithTimeoutFailsWithoutErrorWhenNoChunkIsFreedUntilTheTimeout)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 1U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine;
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    auto chunk1 = sut->getChunk(chunkSettings_32, magazine, 10_ms);
+    auto start = std::chrono::steady_clock::now();
+    auto chunk2 = sut->getChunk(chunkSettings_32, magazine, 10_ms);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(chunk1, Eq(true));
+    EXPECT_THAT(chunk2, Eq(false));
+    EXPECT_THAT(elapsed, Ge(std::chrono::milliseconds(10)));
+    EXPECT_FALSE(detectedError.has_value());
+}
+
+TEST_F(MemoryManager_test, getChunkWithTimeoutWaitsUntilAChunkIsFreed)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 1U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine;
+
+    auto chunk1 = sut->getChunk(chunkSettings_32, magazine, 10_ms);
+    ASSERT_THAT(chunk1, Eq(true));
+    std::thread releasingThread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        chunk1 = nullptr;
+    });
+    auto chunk2 = sut->getChunk(chunkSettings_32, magazine, iox::units::Duration::max());
+    releasingThread.join();
+
+    EXPECT_THAT(chunk2, Eq(true));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithTimeoutIsWokenUpByAChunkWhichIsFreedToAnExtension)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 1U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MemoryManager extension;
+    extension.configureMemoryManager(mempoolconf, *allocator, *allocator);
+    sut->addExtension(extension);
+    iox::mepoo::ChunkMagazine magazine;
+
+    auto chunk1 = sut->getChunk(chunkSettings_32, magazine, 10_ms);
+    auto chunk2 = sut->getChunk(chunkSettings_32, magazine, 10_ms);
+    ASSERT_THAT(chunk2, Eq(true));
+    std::thread releasingThread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        chunk2 = nullptr;
+    });
+    auto chunk3 = sut->getChunk(chunkSettings_32, magazine, iox::units::Duration::max());
+    releasingThread.join();
+
+    EXPECT_THAT(chunk3, Eq(true));
+    EXPECT_THAT(extension.getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithTimeoutIsWokenUpWhenAnExtensionIsAdded)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 1U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MemoryManager extension;
+    extension.configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine;
+
+    auto chunk1 = sut->getChunk(chunkSettings_32, magazine, 10_ms);
+    ASSERT_THAT(chunk1, Eq(true));
+    std::thread extendingThread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        sut->addExtension(extension);
+    });
+    auto chunk2 = sut->getChunk(chunkSettings_32, magazine, iox::units::Duration::max());
+    extendingThread.join();
+
+    EXPECT_THAT(chunk2, Eq(true));
+    EXPECT_THAT(extension.getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+}
+
+} // namespace
@@ -19,6 +19,8 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "test.hpp"
 
+#include <set>
+
 namespace
 {
 using namespace ::testing;
@@ -206,4 +208,249 @@ TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsNotPowerOf32)
     EXPECT_DEATH({ iox::mepoo::MemPool sut(333, 10, allocator, allocator); }, ".*");
 }
 
+TEST_F(MemPool_test, GetChunkWithMagazineRefillsMagazineInBatch)
+{
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    iox::mepoo::MemPool sutWithMagazine(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, MAGAZINE_CAPACITY);
+    MemPoolMagazine magazine;
+
+    EXPECT_THAT(sutWithMagazine.getChunk(magazine), Ne(nullptr));
+
+    EXPECT_THAT(magazine.m_numberOfIndices, Eq(MAGAZINE_CAPACITY - 1U));
+    EXPECT_THAT(sutWithMagazine.getUsedChunks(), Eq(1U));
+}
+
+TEST_F(MemPool_test, GetChunkWithMagazineReturnsAllChunksBeforeReturningNullPointer)
+{
+    constexpr uint32_t MAGAZINE_CAPACITY{3U};
+    iox::mepoo::MemPool sutWithMagazine(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, MAGAZINE_CAPACITY);
+    MemPoolMagazine magazine;
+
+    std::set<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto chunk = sutWithMagazine.getChunk(magazine);
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.insert(chunk);
+    }
+
+    EXPECT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sutWithMagazine.getChunk(magazine), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, GetChunkWithMagazineAndZeroCapacityDoesNotCacheChunks)
+{
+    MemPoolMagazine magazine;
+
+    EXPECT_THAT(sut.getChunk(magazine), Ne(nullptr));
+
+    EXPECT_THAT(magazine.m_numberOfIndices, Eq(0U));
+}
+
+TEST_F(MemPool_test, ReleaseMagazineReturnsCachedChunksToTheMempool)
+{
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    iox::mepoo::MemPool sutWithMagazine(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, MAGAZINE_CAPACITY);
+    MemPoolMagazine magazine;
+    ASSERT_THAT(sutWithMagazine.getChunk(magazine), Ne(nullptr));
+
+    sutWithMagazine.releaseMagazine(magazine);
+
+    EXPECT_THAT(magazine.m_numberOfIndices, Eq(0U));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS - 1U; ++i)
+    {
+        EXPECT_THAT(sutWithMagazine.getChunk(), Ne(nullptr));
+    }
+    EXPECT_THAT(sutWithMagazine.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, ChunksInMagazineAreCountedAsCachedAndNotAsFree)
+{
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    iox::mepoo::MemPool sutWithMagazine(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, MAGAZINE_CAPACITY);
+    MemPoolMagazine magazine;
+
+    ASSERT_THAT(sutWithMagazine.getChunk(magazine), Ne(nullptr));
+
+    EXPECT_THAT(sutWithMagazine.getCachedChunks(), Eq(MAGAZINE_CAPACITY - 1U));
+    EXPECT_THAT(sutWithMagazine.getMinFree(), Eq(NUMBER_OF_CHUNKS - MAGAZINE_CAPACITY));
+    EXPECT_THAT(sutWithMagazine.getInfo().m_cachedChunks, Eq(MAGAZINE_CAPACITY - 1U));
+}
+
+TEST_F(MemPool_test, ReleaseMagazineResetsCachedChunks)
+{
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    iox::mepoo::MemPool sutWithMagazine(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, MAGAZINE_CAPACITY);
+    MemPoolMagazine magazine;
+    ASSERT_THAT(sutWithMagazine.getChunk(magazine), Ne(nullptr));
+
+    sutWithMagazine.releaseMagazine(magazine);
+
+    EXPECT_THAT(sutWithMagazine.getCachedChunks(), Eq(0U));
+}
+
+TEST_F(MemPool_test, ReleaseMagazineAfterInterruptedRefillReturnsTheStoredChunks)
+{
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    iox::mepoo::MemPool sutWithMagazine(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, MAGAZINE_CAPACITY);
+    MemPoolMagazine magazine;
+    ASSERT_THAT(sutWithMagazine.getChunk(magazine), Ne(nullptr));
+    // the owner of the magazine terminated after the indices were taken from the free list
+    magazine.m_refillInProgress = true;
+
+    sutWithMagazine.releaseMagazine(magazine);
+
+    EXPECT_THAT(magazine.m_refillInProgress, Eq(false));
+    EXPECT_THAT(magazine.m_numberOfIndices, Eq(0U));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS - 1U; ++i)
+    {
+        EXPECT_THAT(sutWithMagazine.getChunk(), Ne(nullptr));
+    }
+    EXPECT_THAT(sutWithMagazine.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, dieWhenMagazineCapacityExceedsLimit)
+{
+    EXPECT_DEATH(
+        {
+            iox::mepoo::MemPool sut(
+                CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, iox::MAX_CHUNK_MAGAZINE_CAPACITY + 1U);
+        },
+        ".*");
+}
+
+class MemPoolWithMultipleChunkSizes_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_CHUNKS{4U};
+    static constexpr uint32_t NUMBER_OF_CHUNK_SIZES{4U};
+    static constexpr uint32_t MAX_CHUNK_SIZE{256U};
+    static constexpr uint32_t MIN_CHUNK_SIZE{MAX_CHUNK_SIZE >> (NUMBER_OF_CHUNK_SIZES - 1U)};
+    static constexpr uint32_t NUMBER_OF_MIN_CHUNKS{NUMBER_OF_CHUNKS << (NUMBER_OF_CHUNK_SIZES - 1U)};
+    static constexpr uint32_t MEMORY_SIZE{NUMBER_OF_CHUNKS * MAX_CHUNK_SIZE + 1024U};
+
+    MemPoolWithMultipleChunkSizes_test()
+        : allocator(m_rawMemory, MEMORY_SIZE)
+        , sut(MAX_CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, 0U, NUMBER_OF_CHUNK_SIZES)
+    {
+    }
+
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t m_rawMemory[MEMORY_SIZE];
+    iox::posix::Allocator allocator;
+
+    MemPool sut;
+};
+
+constexpr uint32_t MemPoolWithMultipleChunkSizes_test::MIN_CHUNK_SIZE;
+constexpr uint32_t MemPoolWithMultipleChunkSizes_test::MAX_CHUNK_SIZE;
+constexpr uint32_t MemPoolWithMultipleChunkSizes_test::NUMBER_OF_CHUNKS;
+constexpr uint32_t MemPoolWithMultipleChunkSizes_test::NUMBER_OF_MIN_CHUNKS;
+
+TEST_F(MemPoolWithMultipleChunkSizes_test, FittingChunkSizeIsTheSmallestPowerOfTwoMultipleOfTheMinChunkSize)
+{
+    EXPECT_THAT(sut.getChunkSize(), Eq(MAX_CHUNK_SIZE));
+    EXPECT_THAT(sut.getMinChunkSize(), Eq(MIN_CHUNK_SIZE));
+    EXPECT_THAT(sut.fittingChunkSize(1U), Eq(MIN_CHUNK_SIZE));
+    EXPECT_THAT(sut.fittingChunkSize(MIN_CHUNK_SIZE), Eq(MIN_CHUNK_SIZE));
+    EXPECT_THAT(sut.fittingChunkSize(MIN_CHUNK_SIZE + 1U), Eq(2U * MIN_CHUNK_SIZE));
+    EXPECT_THAT(sut.fittingChunkSize(MAX_CHUNK_SIZE), Eq(MAX_CHUNK_SIZE));
+    EXPECT_THAT(sut.fittingChunkSize(MAX_CHUNK_SIZE + 1U), Eq(MAX_CHUNK_SIZE));
+}
+
+TEST_F(MemPoolWithMultipleChunkSizes_test, LargeChunksAreSplitIntoDistinctSmallChunks)
+{
+    std::set<uint8_t*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_MIN_CHUNKS; ++i)
+    {
+        auto chunk = static_cast<uint8_t*>(sut.getChunk(MIN_CHUNK_SIZE));
+        ASSERT_THAT(chunk, Ne(nullptr));
+        EXPECT_THAT(chunk, Ge(m_rawMemory));
+        EXPECT_THAT(chunk + MIN_CHUNK_SIZE, Le(m_rawMemory + MEMORY_SIZE));
+        EXPECT_TRUE(chunks.insert(chunk).second);
+    }
+
+    EXPECT_THAT(sut.getChunk(MIN_CHUNK_SIZE), Eq(nullptr));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_MIN_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(0U));
+}
+
+TEST_F(MemPoolWithMultipleChunkSizes_test, UsedChunksAreCountedInChunksOfTheMinChunkSize)
+{
+    ASSERT_THAT(sut.getChunk(MAX_CHUNK_SIZE), Ne(nullptr));
+    ASSERT_THAT(sut.getChunk(2U * MIN_CHUNK_SIZE), Ne(nullptr));
+
+    auto info = sut.getInfo();
+    EXPECT_THAT(info.m_usedChunks, Eq(MAX_CHUNK_SIZE / MIN_CHUNK_SIZE + 2U));
+    EXPECT_THAT(info.m_numChunks, Eq(NUMBER_OF_MIN_CHUNKS));
+    EXPECT_THAT(info.m_chunkSize, Eq(MIN_CHUNK_SIZE));
+    EXPECT_THAT(info.m_maxChunkSize, Eq(MAX_CHUNK_SIZE));
+}
+
+TEST_F(MemPoolWithMultipleChunkSizes_test, FreedSmallChunksAreCoalescedToLargeChunks)
+{
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_MIN_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk(MIN_CHUNK_SIZE));
+        ASSERT_THAT(chunks.back(), Ne(nullptr));
+    }
+    for (auto chunk : chunks)
+    {
+        sut.freeChunk(chunk);
+    }
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(MAX_CHUNK_SIZE), Ne(nullptr));
+    }
+}
+
+TEST_F(MemPoolWithMultipleChunkSizes_test, GetChunkWithoutSizeAcquiresChunkOfMaxChunkSize)
+{
+    ASSERT_THAT(sut.getChunk(), Ne(nullptr));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(MAX_CHUNK_SIZE / MIN_CHUNK_SIZE));
+}
+
+TEST_F(MemPoolWithMultipleChunkSizes_test, FreeChunkTwiceCallsErrorHandler)
+{
+    auto chunk = sut.getChunk(2U * MIN_CHUNK_SIZE);
+    ASSERT_THAT(chunk, Ne(nullptr));
+    sut.freeChunk(chunk);
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    sut.freeChunk(chunk);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(MemPoolWithMultipleChunkSizes_test, InternalFragmentationIsReportedUntilItIsRemoved)
+{
+    constexpr uint32_t UNUSED_BYTES{42U};
+    sut.addInternalFragmentation(UNUSED_BYTES);
+    sut.addInternalFragmentation(UNUSED_BYTES);
+
+    EXPECT_THAT(sut.getInternalFragmentation(), Eq(2U * UNUSED_BYTES));
+    EXPECT_THAT(sut.getInfo().m_internalFragmentation, Eq(2U * UNUSED_BYTES));
+
+    sut.removeInternalFragmentation(UNUSED_BYTES);
+    sut.removeInternalFragmentation(UNUSED_BYTES);
+
+    EXPECT_THAT(sut.getInternalFragmentation(), Eq(0U));
+}
+
+TEST_F(MemPoolWithMultipleChunkSizes_test, dieWhenMagazineIsUsedWithMultipleChunkSizes)
+{
+    EXPECT_DEATH(
+        { iox::mepoo::MemPool sutWithMagazine(MAX_CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, 1U, 2U); },
+        ".*");
+}
+
 } // namespace
@@ -62,19 +62,24 @@ class MePooSegment_test : public Test
                                              const iox::posix::AccessMode,
                                              const iox::posix::OpenMode,
                                              const void*,
-                                             const mode_t)>;
+                                             const mode_t,
+                                             const uint64_t)>;
         SharedMemoryObject_MOCK(const SharedMemory::Name_t& name,
                                 const uint64_t memorySizeInBytes,
                                 const AccessMode accessMode,
                                 const OpenMode openMode,
                                 const void* baseAddressHint,
-                                const mode_t permissions)
+                                const mode_t permissions,
+                                const uint64_t hugePageSize,
+                                const SharedMemoryProvisioning& provisioning)
             : m_memorySizeInBytes(memorySizeInBytes)
             , m_baseAddressHint(const_cast<void*>(baseAddressHint))
+            , m_provisioning(provisioning)
         {
             if (createVerificator)
             {
-                createVerificator(name, memorySizeInBytes, accessMode, openMode, baseAddressHint, permissions);
+                createVerificator(
+                    name, memorySizeInBytes, accessMode, openMode, baseAddressHint, permissions, hugePageSize);
             }
             filehandle = creat("/tmp/roudi_segment_test", S_IRWXU);
             m_isInitialized = true;
@@ -114,8 +119,14 @@ class MePooSegment_test : public Test
             return m_baseAddressHint;
         }
 
+        uint64_t getPageSize() const
+        {
+            return 4096U;
+        }
+
         uint64_t m_memorySizeInBytes{0};
         void* m_baseAddressHint{nullptr};
+        SharedMemoryProvisioning m_provisioning;
         static constexpr int MEM_SIZE = 100000;
         char memory[MEM_SIZE];
         std::shared_ptr<iox::posix::Allocator> allocator{new iox::posix::Allocator(memory, MEM_SIZE)};
@@ -155,10 +166,12 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SharedMemoryCreationPara
                                                                        const iox::posix::AccessMode f_accessMode,
                                                                        const iox::posix::OpenMode openMode,
                                                                        const void*,
-                                                                       const mode_t) {
+                                                                       const mode_t,
+                                                                       const uint64_t hugePageSize) {
         EXPECT_THAT(std::string(f_name), Eq(std::string("/iox_roudi_test2")));
         EXPECT_THAT(f_accessMode, Eq(iox::posix::AccessMode::READ_WRITE));
         EXPECT_THAT(openMode, Eq(iox::posix::OpenMode::PURGE_AND_CREATE));
+        EXPECT_THAT(hugePageSize, Eq(SharedMemory::NO_HUGE_PAGES));
     };
     MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
         mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
@@ -174,7 +187,8 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetSharedMemoryObject))
                                                                         const iox::posix::AccessMode,
                                                                         const iox::posix::OpenMode,
                                                                         const void*,
-                                                                        const mode_t) {
+                                                                        const mode_t,
+                                                                        const uint64_t) {
         memorySizeInBytes = f_memorySizeInBytes;
     };
     MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
@@ -185,6 +199,115 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetSharedMemoryObject))
     EXPECT_THAT(sut2.getSharedMemoryObject().getSizeInBytes(), Eq(memorySizeInBytes));
 }
 
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(HugePageSizeIsForwardedToSharedMemoryObject))
+{
+    constexpr uint64_t HUGE_PAGE_SIZE{2U * 1024U * 1024U};
+    uint64_t hugePageSize{SharedMemory::NO_HUGE_PAGES};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator = [&](const SharedMemory::Name_t,
+                                                                        const uint64_t,
+                                                                        const iox::posix::AccessMode,
+                                                                        const iox::posix::OpenMode,
+                                                                        const void*,
+                                                                        const mode_t,
+                                                                        const uint64_t f_hugePageSize) {
+        hugePageSize = f_hugePageSize;
+    };
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{mepooConfig,
+                                                              m_managementAllocator,
+                                                              PosixGroup::getGroupOfCurrentProcess(),
+                                                              PosixGroup::getGroupOfCurrentProcess(),
+                                                              iox::mepoo::MemoryInfo(),
+                                                              HUGE_PAGE_SIZE};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    EXPECT_THAT(hugePageSize, Eq(HUGE_PAGE_SIZE));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(HugePagesAreNotUsedForOtherGroupsThanTheOneOfRouDi))
+{
+    constexpr uint64_t HUGE_PAGE_SIZE{2U * 1024U * 1024U};
+    uint64_t hugePageSize{HUGE_PAGE_SIZE};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator = [&](const SharedMemory::Name_t,
+                                                                        const uint64_t,
+                                                                        const iox::posix::AccessMode,
+                                                                        const iox::posix::OpenMode,
+                                                                        const void*,
+                                                                        const mode_t,
+                                                                        const uint64_t f_hugePageSize) {
+        hugePageSize = f_hugePageSize;
+    };
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{mepooConfig,
+                                                              m_managementAllocator,
+                                                              PosixGroup{"iox_roudi_test1"},
+                                                              PosixGroup{"iox_roudi_test2"},
+                                                              iox::mepoo::MemoryInfo(),
+                                                              HUGE_PAGE_SIZE};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    EXPECT_THAT(hugePageSize, Eq(SharedMemory::NO_HUGE_PAGES));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(ProvisioningIsForwardedToSharedMemoryObject))
+{
+    SharedMemoryProvisioning provisioning;
+    provisioning.m_prefaultMode = PrefaultMode::TOUCH_PAGES;
+    provisioning.m_lockPages = true;
+    provisioning.m_skipZeroing = true;
+    provisioning.m_numberOfWorkerThreads = 8U;
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{mepooConfig,
+                                                              m_managementAllocator,
+                                                              PosixGroup{"iox_roudi_test1"},
+                                                              PosixGroup{"iox_roudi_test2"},
+                                                              iox::mepoo::MemoryInfo(),
+                                                              SharedMemory::NO_HUGE_PAGES,
+                                                              provisioning};
+
+    const auto& forwardedProvisioning = sut2.getSharedMemoryObject().m_provisioning;
+    EXPECT_THAT(forwardedProvisioning.m_prefaultMode, Eq(PrefaultMode::TOUCH_PAGES));
+    EXPECT_TRUE(forwardedProvisioning.m_lockPages);
+    EXPECT_TRUE(forwardedProvisioning.m_skipZeroing);
+    EXPECT_THAT(forwardedProvisioning.m_numberOfWorkerThreads, Eq(8U));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(EmbeddedChunkManagementWithDifferentReaderAndWriterGroupFails))
+{
+    MePooConfig embeddedMepooConfig = mepooConfig;
+    embeddedMepooConfig.m_chunkManagementLayout = ChunkManagementLayout::EMBEDDED;
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_EQ(errorLevel, iox::ErrorLevel::FATAL);
+        });
+
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        embeddedMepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(),
+              iox::Error::kMEPOO__SEGMENT_EMBEDDED_CHUNK_MANAGEMENT_REQUIRES_SAME_READER_AND_WRITER_GROUP);
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(EmbeddedChunkManagementWithSameReaderAndWriterGroupSucceeds))
+{
+    MePooConfig embeddedMepooConfig = mepooConfig;
+    embeddedMepooConfig.m_chunkManagementLayout = ChunkManagementLayout::EMBEDDED;
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        embeddedMepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test2"}, PosixGroup{"iox_roudi_test2"}};
+
+    EXPECT_FALSE(detectedError.has_value());
+}
+
 TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetReaderGroup))
 {
     EXPECT_THAT(sut.getReaderGroup(), Eq(iox::posix::PosixGroup("iox_roudi_test1")));
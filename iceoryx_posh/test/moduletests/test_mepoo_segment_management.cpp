@@ -41,7 +41,10 @@ class MePooSegmentMock
                      Allocator& managementAllocator IOX_MAYBE_UNUSED,
                      const PosixGroup& readerGroup IOX_MAYBE_UNUSED,
                      const PosixGroup& writerGroup IOX_MAYBE_UNUSED,
-                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED) noexcept
+                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED,
+                     const uint64_t hugePageSize IOX_MAYBE_UNUSED,
+                     const SharedMemoryProvisioning& provisioning IOX_MAYBE_UNUSED,
+                     const uint32_t extensionIndex IOX_MAYBE_UNUSED = 0U) noexcept
     {
     }
 };
@@ -201,4 +204,144 @@ TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(addingMaximumNumberOfS
     SegmentManager<MePooSegmentMock> sut{segmentConfig, &allocator};
 }
 
+class SegmentManagerGrowth_test : public Test
+{
+  public:
+    void TearDown() override
+    {
+        iox::rp::BaseRelativePointer::unregisterAll();
+    }
+
+    SegmentConfig getGrowableSegmentConfig(const uint32_t maxExtensions, const uint32_t highWaterMark)
+    {
+        MePooConfig mepooConfig;
+        mepooConfig.addMemPool({CHUNK_PAYLOAD_SIZE, CHUNK_COUNT});
+        SegmentGrowth growth;
+        growth.m_maxExtensions = maxExtensions;
+        growth.m_highWaterMark = highWaterMark;
+
+        SegmentConfig config;
+        config.m_sharedMemorySegments.push_back(
+            {groupName, groupName, mepooConfig, MemoryInfo(), SharedMemory::NO_HUGE_PAGES, {}, growth});
+        return config;
+    }
+
+    MemoryManager& getMemoryManager(SegmentManager<>& sut)
+    {
+        return sut.getSegmentInformationWithWriteAccessForUser(PosixUser::getUserOfCurrentProcess())
+            .m_memoryManager.value()
+            .get();
+    }
+
+    static constexpr uint32_t CHUNK_PAYLOAD_SIZE{128U};
+    static constexpr uint32_t CHUNK_COUNT{4U};
+    static constexpr size_t MEM_SIZE{20000};
+    alignas(8) char memory[MEM_SIZE];
+    iox::posix::Allocator allocator{memory, MEM_SIZE};
+    PosixGroup::string_t groupName{PosixGroup::getGroupOfCurrentProcess().getName()};
+    ChunkSettings chunkSettings{
+        ChunkSettings::create(CHUNK_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value()};
+};
+
+constexpr uint32_t SegmentManagerGrowth_test::CHUNK_PAYLOAD_SIZE;
+constexpr uint32_t SegmentManagerGrowth_test::CHUNK_COUNT;
+
+TEST_F(SegmentManagerGrowth_test, SegmentIsNotExtendedBelowHighWaterMark)
+{
+    SegmentManager<> sut{getGrowableSegmentConfig(2U, 50U), &allocator};
+    auto chunk = getMemoryManager(sut).getChunk(chunkSettings);
+    ASSERT_TRUE(chunk);
+
+    sut.extendSegmentsAboveHighWaterMark();
+
+    EXPECT_THAT(sut.getSegmentMappings(PosixUser::getUserOfCurrentProcess()).size(), Eq(1U));
+    EXPECT_THAT(getMemoryManager(sut).getExtension(), Eq(nullptr));
+}
+
+TEST_F(SegmentManagerGrowth_test, SegmentIsExtendedAtHighWaterMark)
+{
+    SegmentManager<> sut{getGrowableSegmentConfig(2U, 50U), &allocator};
+    auto chunk1 = getMemoryManager(sut).getChunk(chunkSettings);
+    auto chunk2 = getMemoryManager(sut).getChunk(chunkSettings);
+    ASSERT_TRUE(chunk1 && chunk2);
+
+    sut.extendSegmentsAboveHighWaterMark();
+
+    auto mappings = sut.getSegmentMappings(PosixUser::getUserOfCurrentProcess());
+    ASSERT_THAT(mappings.size(), Eq(2U));
+    EXPECT_TRUE(mappings[1].m_isWritable);
+    EXPECT_THAT(mappings[1].m_sharedMemoryName, Eq(iox::ShmName_t("/") + groupName + iox::ShmName_t("_ext1")));
+    EXPECT_THAT(mappings[1].m_segmentId, Ne(mappings[0].m_segmentId));
+    EXPECT_THAT(getMemoryManager(sut).getExtension(), Ne(nullptr));
+}
+
+TEST_F(SegmentManagerGrowth_test, SegmentWithoutGrowthIsNotExtended)
+{
+    SegmentManager<> sut{getGrowableSegmentConfig(0U, 50U), &allocator};
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        chunks.push_back(getMemoryManager(sut).getChunk(chunkSettings));
+    }
+
+    sut.extendSegmentsAboveHighWaterMark();
+
+    EXPECT_THAT(sut.getSegmentMappings(PosixUser::getUserOfCurrentProcess()).size(), Eq(1U));
+}
+
+TEST_F(SegmentManagerGrowth_test, SegmentIsExtendedAtMostMaxExtensionsTimes)
+{
+    constexpr uint32_t MAX_EXTENSIONS{2U};
+    SegmentManager<> sut{getGrowableSegmentConfig(MAX_EXTENSIONS, 100U), &allocator};
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (uint32_t i = 0U; i <= MAX_EXTENSIONS + 1U; ++i)
+    {
+        while (auto chunk = getMemoryManager(sut).getChunk(chunkSettings))
+        {
+            chunks.push_back(chunk);
+            if (chunks.size() % CHUNK_COUNT == 0U)
+            {
+                break;
+            }
+        }
+        sut.extendSegmentsAboveHighWaterMark();
+    }
+
+    EXPECT_THAT(sut.getSegmentMappings(PosixUser::getUserOfCurrentProcess()).size(), Eq(1U + MAX_EXTENSIONS));
+    EXPECT_THAT(chunks.size(), Eq(CHUNK_COUNT * (1U + MAX_EXTENSIONS)));
+}
+
+TEST_F(SegmentManagerGrowth_test, ChunksOfExtensionAreAcquiredWhenConfiguredSegmentIsExhausted)
+{
+    SegmentManager<> sut{getGrowableSegmentConfig(1U, 100U), &allocator};
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        chunks.push_back(getMemoryManager(sut).getChunk(chunkSettings));
+    }
+    sut.extendSegmentsAboveHighWaterMark();
+
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        chunks.push_back(getMemoryManager(sut).getChunk(chunkSettings));
+        ASSERT_TRUE(chunks.back());
+    }
+    auto extension = getMemoryManager(sut).getExtension();
+    ASSERT_THAT(extension, Ne(nullptr));
+    EXPECT_THAT(extension->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(SegmentManagerGrowth_test, RequiredManagementMemorySizeIncludesMaxExtensions)
+{
+    constexpr uint32_t MAX_EXTENSIONS{3U};
+    auto config = getGrowableSegmentConfig(MAX_EXTENSIONS, 50U);
+    const auto managementMemorySizeOfSegment =
+        MemoryManager::requiredManagementMemorySize(config.m_sharedMemorySegments[0].m_mempoolConfig);
+
+    EXPECT_THAT(SegmentManager<>::requiredManagementMemorySize(config),
+                Eq(managementMemorySizeOfSegment * (1U + MAX_EXTENSIONS)));
+    EXPECT_THAT(SegmentManager<>::requiredChunkMemorySize(config),
+                Eq(MemoryManager::requiredChunkMemorySize(config.m_sharedMemorySegments[0].m_mempoolConfig)));
+}
+
 } // namespace
@@ -19,8 +19,14 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "test.hpp"
 
+#include "iceoryx_hoofs/platform/mman.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -299,4 +305,65 @@ TEST_F(SharedChunk_Test, ReleaseMethodReturnsChunkManagementPointerOfSharedChunk
     EXPECT_EQ(sut.getChunkHeader(), nullptr);
 }
 
+TEST_F(SharedChunk_Test, SharedChunkWithEmbeddedChunkManagementReturnsChunkToMemPoolWhenReleased)
+{
+    MePooConfig mempoolConfig;
+    mempoolConfig.m_chunkManagementLayout = ChunkManagementLayout::EMBEDDED;
+    mempoolConfig.addMemPool({USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS});
+    std::vector<uint8_t> memory(MemoryManager::requiredFullMemorySize(mempoolConfig));
+    iox::posix::Allocator memoryAllocator{memory.data(), memory.size()};
+    MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, memoryAllocator, memoryAllocator);
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    {
+        SharedChunk sut1 = memoryManager.getChunk(chunkSettingsResult.value());
+        ASSERT_THAT(sut1, Eq(true));
+        // the ChunkManagement is located in front of the ChunkHeader in the chunk itself
+        auto embeddedChunkManagement = sut1.release();
+        EXPECT_TRUE(embeddedChunkManagement->isEmbedded());
+        EXPECT_THAT(static_cast<void*>(embeddedChunkManagement->m_chunkHeader.get()),
+                    Eq(static_cast<void*>(reinterpret_cast<uint8_t*>(embeddedChunkManagement)
+                                          + MemoryManager::EMBEDDED_CHUNK_MANAGEMENT_SIZE)));
+
+        SharedChunk sut2(embeddedChunkManagement);
+        EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+    }
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(SharedChunk_Test, SharedChunkWithChunkManagementInMempoolIsReleasedWhenChunkMemoryIsReadOnly)
+{
+    // a subscriber which is only in the reader group maps the payload segment read-only; cloning and releasing a
+    // sample must therefore not write to the chunk memory
+    const auto pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS});
+    const uint64_t chunkMemorySize =
+        iox::cxx::align(MemoryManager::requiredChunkMemorySize(mempoolConfig), pageSize);
+    void* chunkMemory = mmap(nullptr, chunkMemorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_THAT(chunkMemory, Ne(MAP_FAILED));
+    iox::posix::Allocator chunkMemoryAllocator{chunkMemory, chunkMemorySize};
+    std::vector<uint8_t> managementMemory(MemoryManager::requiredManagementMemorySize(mempoolConfig));
+    iox::posix::Allocator managementAllocator{managementMemory.data(), managementMemory.size()};
+    MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, chunkMemoryAllocator);
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    {
+        SharedChunk sut1 = memoryManager.getChunk(chunkSettingsResult.value());
+        ASSERT_THAT(sut1, Eq(true));
+        ASSERT_THAT(mprotect(chunkMemory, chunkMemorySize, PROT_READ), Eq(0));
+
+        SharedChunk sut2(sut1);
+        EXPECT_THAT(sut2.getChunkHeader(), Eq(sut1.getChunkHeader()));
+    }
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    munmap(chunkMemory, chunkMemorySize);
+}
+
 } // namespace
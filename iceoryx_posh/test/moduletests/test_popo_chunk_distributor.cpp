@@ -16,6 +16,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/platform/wait.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
@@ -26,7 +28,9 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "test.hpp"
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 namespace
 {
@@ -647,4 +651,138 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesDoesNotWaitForTheLockOfTheQueueModification)
+{
+    using ChunkDistributorData_t = typename TestFixture::ChunkDistributorData_t;
+    auto sutData = std::make_shared<ChunkDistributorData_t>(SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA, 0U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sutData->lock();
+    auto chunkDeliveredSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::thread t1([&] {
+        sut.deliverToAllStoredQueues(this->allocateChunk(4711U));
+        ASSERT_FALSE(chunkDeliveredSemaphore->post().has_error());
+    });
+
+    // the deadline only prevents a hanging test in case of a regression
+    auto waitResult = chunkDeliveredSemaphore->timedWait(iox::units::Duration::fromSeconds(10U));
+    ASSERT_FALSE(waitResult.has_error());
+    EXPECT_THAT(waitResult.value(), Eq(iox::posix::SemaphoreWaitState::NO_TIMEOUT));
+    sutData->unlock();
+    t1.join();
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4711U));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovedQueueDoesNotReceiveChunksWhenDeliveringConcurrently)
+{
+    using ChunkDistributorData_t = typename TestFixture::ChunkDistributorData_t;
+    auto sutData = std::make_shared<ChunkDistributorData_t>(SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA, 0U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    std::atomic_bool keepDelivering{true};
+    std::thread sender([&] {
+        while (keepDelivering)
+        {
+            sut.deliverToAllStoredQueues(this->allocateChunk(1337U));
+        }
+    });
+
+    constexpr uint64_t NUMBER_OF_ITERATIONS{1000U};
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+        ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+        while (queue.tryPop().has_value())
+        {
+        }
+        EXPECT_FALSE(queue.tryPop().has_value());
+    }
+
+    keepDelivering = false;
+    sender.join();
+}
+
+TYPED_TEST(ChunkDistributor_test, RemoveQueueReturnsOnlyAfterTheQueueSnapshotIsReleased)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // emulates a sender of this process which is still delivering to the queues
+    const auto readSnapshot = sutData->m_activeQueueSnapshot.load();
+    sutData->m_queueSnapshotReaderPid.store(getpid());
+    sutData->m_queueSnapshotReaders[readSnapshot].fetch_add(1U);
+
+    std::atomic_bool wasQueueRemoved{false};
+    std::thread t1([&] {
+        EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+        wasQueueRemoved = true;
+    });
+
+    // the snapshot is swapped before the removal waits for the readers of the previous one
+    while (sutData->m_activeQueueSnapshot.load() == readSnapshot)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(wasQueueRemoved.load());
+
+    sutData->m_queueSnapshotReaders[readSnapshot].fetch_sub(1U);
+    t1.join();
+    EXPECT_TRUE(wasQueueRemoved.load());
+    EXPECT_FALSE(sut.hasStoredQueues());
+}
+
+TYPED_TEST(ChunkDistributor_test, RemoveQueueReleasesTheQueueSnapshotOfATerminatedSender)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    pid_t terminatedSender = fork();
+    ASSERT_THAT(terminatedSender, Ne(-1));
+    if (terminatedSender == 0)
+    {
+        _exit(0);
+    }
+    ASSERT_THAT(waitpid(terminatedSender, nullptr, 0), Eq(terminatedSender));
+
+    // emulates a sender which was terminated while delivering to the queues
+    const auto readSnapshot = sutData->m_activeQueueSnapshot.load();
+    sutData->m_queueSnapshotReaderPid.store(terminatedSender);
+    sutData->m_queueSnapshotReaders[readSnapshot].fetch_add(1U);
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_THAT(sutData->m_queueSnapshotReaders[readSnapshot].load(), Eq(0U));
+    EXPECT_FALSE(sut.hasStoredQueues());
+}
+
+TYPED_TEST(ChunkDistributor_test, CleanupReleasesTheQueueSnapshotsOfATerminatedSender)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    for (auto& readers : sutData->m_queueSnapshotReaders)
+    {
+        readers.fetch_add(1U);
+    }
+    sut.cleanup();
+
+    for (auto& readers : sutData->m_queueSnapshotReaders)
+    {
+        EXPECT_THAT(readers.load(), Eq(0U));
+    }
+}
+
 } // namespace
@@ -33,11 +33,15 @@
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "test.hpp"
 
+#include <chrono>
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace
 {
 using namespace ::testing;
+using namespace iox::units::duration_literals;
 
 struct DummySample
 {
@@ -410,6 +414,56 @@ TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
     EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS));
 }
 
+TEST_F(ChunkSender_test, allocateWithWaitForChunkPolicyFailsWithoutErrorHandlerCallAfterTheLoanTimeout)
+{
+    m_chunkSenderData.m_memPoolExhaustedPolicy = iox::popo::MemPoolExhaustedPolicy::WAIT_FOR_CHUNK;
+    m_chunkSenderData.m_loanTimeout = 10_ms;
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    for (size_t i = 0; i < NUM_CHUNKS_IN_POOL; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&errorHandlerCalled](const iox::Error, const std::function<void()>, const iox::ErrorLevel) {
+            errorHandlerCalled = true;
+        });
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS));
+    EXPECT_FALSE(errorHandlerCalled);
+}
+
+TEST_F(ChunkSender_test, allocateWithWaitForChunkPolicySucceedsWhenTheReceiverReleasesAChunk)
+{
+    m_chunkSenderData.m_memPoolExhaustedPolicy = iox::popo::MemPoolExhaustedPolicy::WAIT_FOR_CHUNK;
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> checkQueue(&m_chunkQueueData);
+    for (size_t i = 0; i < NUM_CHUNKS_IN_POOL; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    std::thread receivingThread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        EXPECT_TRUE(checkQueue.tryPop().has_value());
+    });
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    receivingThread.join();
+
+    EXPECT_FALSE(maybeChunkHeader.has_error());
+}
+
 TEST_F(ChunkSender_test, sendInvalidChunk)
 {
     auto maybeChunkHeader = m_chunkSender.tryAllocate(
@@ -631,4 +685,32 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, CleanupReturnsChunksCachedInMagazine)
+{
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    iox::mepoo::MePooConfig mempoolconf;
+    mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL, MAGAZINE_CAPACITY});
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    ChunkSenderData_t chunkSenderData{&memoryManager, iox::popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA, 0};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+
+    auto maybeChunkHeader = sut.tryAllocate(
+        iox::UniquePortId(), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(chunkSenderData.m_chunkMagazine.m_memPoolMagazines[0].m_numberOfIndices, Eq(MAGAZINE_CAPACITY - 1U));
+
+    sut.releaseAll();
+
+    EXPECT_THAT(chunkSenderData.m_chunkMagazine.m_memPoolMagazines[0].m_numberOfIndices, Eq(0U));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (uint32_t i = 0; i < NUM_CHUNKS_IN_POOL; i++)
+    {
+        chunks.push_back(memoryManager.getChunk(
+            iox::mepoo::ChunkSettings::create(SMALL_CHUNK, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value()));
+        EXPECT_TRUE(chunks.back());
+    }
+}
+
 } // namespace
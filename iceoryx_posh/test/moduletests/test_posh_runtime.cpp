@@ -277,6 +277,31 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherIsSuccessful)
     EXPECT_EQ(publisherOptions.historyCapacity, publisherPort->m_chunkSenderData.m_historyCapacity);
 }
 
+TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithWaitForChunkPolicyTransfersPolicyAndLoanTimeout)
+{
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.memPoolExhaustedPolicy = iox::popo::MemPoolExhaustedPolicy::WAIT_FOR_CHUNK;
+    publisherOptions.loanTimeout = iox::units::Duration::fromMilliseconds(42);
+
+    const auto publisherPort =
+        m_runtime->getMiddlewarePublisher(iox::capro::ServiceDescription("99", "1", "20"), publisherOptions);
+
+    ASSERT_NE(nullptr, publisherPort);
+    EXPECT_EQ(publisherPort->m_chunkSenderData.m_memPoolExhaustedPolicy,
+              iox::popo::MemPoolExhaustedPolicy::WAIT_FOR_CHUNK);
+    EXPECT_EQ(publisherPort->m_chunkSenderData.m_loanTimeout, iox::units::Duration::fromMilliseconds(42));
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithDefaultLoanTimeoutTransfersInfiniteTimeout)
+{
+    const auto publisherPort = m_runtime->getMiddlewarePublisher(iox::capro::ServiceDescription("99", "1", "20"));
+
+    ASSERT_NE(nullptr, publisherPort);
+    EXPECT_EQ(publisherPort->m_chunkSenderData.m_memPoolExhaustedPolicy,
+              iox::popo::MemPoolExhaustedPolicy::RETURN_ERROR);
+    EXPECT_EQ(publisherPort->m_chunkSenderData.m_loanTimeout, iox::units::Duration::max());
+}
+
 TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithHistoryGreaterMaxCapacityClampsHistoryToMaximum)
 {
     // arrange
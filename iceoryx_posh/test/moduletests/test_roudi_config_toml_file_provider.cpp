@@ -76,6 +76,31 @@ INSTANTIATE_TEST_CASE_P(
                                  "roudi_config_error_mempool_without_chunk_size.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  "roudi_config_error_mempool_without_chunk_count.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_MAGAZINE_CAPACITY_EXCEEDED,
+                                 "roudi_config_error_mempool_magazine_capacity_exceeded.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_MIN_SIZE,
+                                 "roudi_config_error_invalid_mempool_min_size.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_MAGAZINE_WITH_MIN_SIZE,
+                                 "roudi_config_error_mempool_magazine_with_min_size.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_CHUNK_MANAGEMENT_LAYOUT,
+                                 "roudi_config_error_invalid_chunk_management_layout.toml"},
+           ParseErrorInputFile_t{
+               iox::roudi::RouDiConfigFileParseError::EMBEDDED_CHUNK_MANAGEMENT_WITH_DIFFERENT_READER_AND_WRITER_GROUP,
+               "roudi_config_error_embedded_chunk_management_with_different_reader_and_writer_group.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_SIZE,
+                                 "roudi_config_error_invalid_huge_page_size.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_PREFAULT_MODE,
+                                 "roudi_config_error_invalid_prefault_mode.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_POLICY,
+                                 "roudi_config_error_invalid_numa_policy.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES,
+                                 "roudi_config_error_numa_policy_without_numa_nodes.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES,
+                                 "roudi_config_error_numa_node_out_of_range.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_HIGH_WATER_MARK,
+                                 "roudi_config_error_invalid_high_water_mark.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_SEGMENTS_EXCEEDED,
+                                 "roudi_config_error_max_segments_exceeded_by_extensions.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  "toml_parser_exception.toml"}));
 #pragma GCC diagnostic pop
@@ -0,0 +1,156 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi/mempool_config_generator.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using iox::roudi::MemPoolConfigGenerator;
+using iox::roudi::MemPoolStatistics;
+using iox::roudi::MemPoolStatisticsInfo;
+
+class MemPoolConfigGenerator_test : public Test
+{
+  public:
+    MemPoolStatistics& addMemPool(const uint32_t chunkPayloadSize, const uint32_t numChunks)
+    {
+        statistics.m_mempoolStatistics.emplace_back();
+        auto& mempool = statistics.m_mempoolStatistics.back();
+        mempool.m_chunkPayloadSize = chunkPayloadSize;
+        mempool.m_numChunks = numChunks;
+        return mempool;
+    }
+
+    static void addRequests(MemPoolStatistics& mempool,
+                            const uint32_t bin,
+                            const uint32_t maxRequestedChunkPayloadSize,
+                            const uint32_t peakUsedChunks)
+    {
+        mempool.m_histogram[bin].m_numberOfRequests += 100U;
+        mempool.m_histogram[bin].m_maxRequestedChunkPayloadSize = maxRequestedChunkPayloadSize;
+        mempool.m_histogram[bin].m_peakUsedChunks = peakUsedChunks;
+    }
+
+    MemPoolStatisticsInfo statistics;
+};
+
+TEST_F(MemPoolConfigGenerator_test, SegmentWithoutRequestsKeepsItsMempools)
+{
+    addMemPool(128U, 10U);
+    addMemPool(1024U, 5U);
+
+    auto config = MemPoolConfigGenerator().generate(statistics);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(2U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_size, Eq(128U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_chunkCount, Eq(10U));
+    EXPECT_THAT(config.m_mempoolConfig[1].m_size, Eq(1024U));
+    EXPECT_THAT(config.m_mempoolConfig[1].m_chunkCount, Eq(5U));
+}
+
+TEST_F(MemPoolConfigGenerator_test, BinWithRequestsResultsInMempoolWithLargestRequestedSizeAndPeakPlusHeadroom)
+{
+    auto& mempool = addMemPool(1024U, 100U);
+    addRequests(mempool, 3U, 600U, 10U);
+
+    auto config = MemPoolConfigGenerator(20U).generate(statistics);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(1U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_size, Eq(600U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_chunkCount, Eq(12U));
+}
+
+TEST_F(MemPoolConfigGenerator_test, ChunkCountWithHeadroomIsRoundedUp)
+{
+    auto& mempool = addMemPool(1024U, 100U);
+    addRequests(mempool, 0U, 1000U, 3U);
+
+    auto config = MemPoolConfigGenerator(10U).generate(statistics);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(1U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_chunkCount, Eq(4U));
+}
+
+TEST_F(MemPoolConfigGenerator_test, ChunkPayloadSizeIsAlignedToChunkMemoryAlignment)
+{
+    auto& mempool = addMemPool(1024U, 100U);
+    addRequests(mempool, 0U, 1001U, 1U);
+
+    auto config = MemPoolConfigGenerator(0U).generate(statistics);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(1U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_size, Eq(1008U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_chunkCount, Eq(1U));
+}
+
+TEST_F(MemPoolConfigGenerator_test, MempoolsAreOrderedByIncreasingSizeAndEqualSizesAreMerged)
+{
+    auto& smallMempool = addMemPool(256U, 100U);
+    addRequests(smallMempool, 0U, 256U, 4U);
+    addRequests(smallMempool, 5U, 64U, 2U);
+    auto& largeMempool = addMemPool(4096U, 100U);
+    addRequests(largeMempool, 15U, 256U, 6U);
+
+    auto config = MemPoolConfigGenerator(0U).generate(statistics);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(2U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_size, Eq(64U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_chunkCount, Eq(2U));
+    EXPECT_THAT(config.m_mempoolConfig[1].m_size, Eq(256U));
+    EXPECT_THAT(config.m_mempoolConfig[1].m_chunkCount, Eq(10U));
+}
+
+TEST_F(MemPoolConfigGenerator_test, MempoolsWhichExceedTheLimitAreMergedWithTheLeastWastedMemory)
+{
+    constexpr uint32_t NUMBER_OF_BINS{iox::NUMBER_OF_MEMPOOL_HISTOGRAM_BINS};
+    constexpr uint32_t NUMBER_OF_MEMPOOLS{iox::MAX_NUMBER_OF_MEMPOOLS / NUMBER_OF_BINS};
+    uint32_t size{64U};
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        auto& mempool = addMemPool(size * NUMBER_OF_BINS, 100U);
+        for (uint32_t bin = 0U; bin < NUMBER_OF_BINS; ++bin)
+        {
+            addRequests(mempool, bin, size, 1U);
+            size += 64U;
+        }
+    }
+    // the mempool with 128 bytes wastes the least memory when it is merged with this one
+    auto& mempool = addMemPool(size, 100U);
+    addRequests(mempool, 0U, 136U, 1U);
+
+    auto config = MemPoolConfigGenerator(0U).generate(statistics);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(iox::MAX_NUMBER_OF_MEMPOOLS));
+    uint32_t numberOfChunks{0U};
+    for (uint32_t i = 0U; i < config.m_mempoolConfig.size(); ++i)
+    {
+        numberOfChunks += config.m_mempoolConfig[i].m_chunkCount;
+        if (i > 0U)
+        {
+            EXPECT_THAT(config.m_mempoolConfig[i].m_size, Gt(config.m_mempoolConfig[i - 1U].m_size));
+        }
+    }
+    EXPECT_THAT(numberOfChunks, Eq(NUMBER_OF_MEMPOOLS * NUMBER_OF_BINS + 1U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_size, Eq(64U));
+    EXPECT_THAT(config.m_mempoolConfig[1].m_size, Eq(136U));
+    EXPECT_THAT(config.m_mempoolConfig[1].m_chunkCount, Eq(2U));
+    EXPECT_THAT(config.m_mempoolConfig[2].m_size, Eq(192U));
+}
+
+} // namespace
@@ -51,12 +51,34 @@ class MockPublisherPortUserAccess : public MockPublisherPortUser
     }
 };
 
+class SharedMemoryObjectMock
+{
+  public:
+    static constexpr uint64_t PAGE_SIZE{2U * 1024U * 1024U};
+
+    uint64_t getPageSize() const
+    {
+        return PAGE_SIZE;
+    }
+
+    int32_t getNumaNode() const
+    {
+        return 1;
+    }
+};
+constexpr uint64_t SharedMemoryObjectMock::PAGE_SIZE;
+
 class SegmentMock
 {
   public:
     SegmentMock() = default;
     SegmentMock(const SegmentMock&){};
 
+    const SharedMemoryObjectMock& getSharedMemoryObject() const
+    {
+        return sharedMemoryObject;
+    }
+
     MePooMemoryManager_MOCK& getMemoryManager()
     {
         return memoryManager;
@@ -72,13 +94,29 @@ class SegmentMock
         return iox::posix::PosixGroup::getGroupOfCurrentProcess();
     }
 
+    uint32_t getExtensionIndex() const
+    {
+        return 0U;
+    }
+
   private:
     MePooMemoryManager_MOCK memoryManager;
+    SharedMemoryObjectMock sharedMemoryObject;
 };
 
 class SegmentManagerMock
 {
   public:
+    uint64_t numberOfSegments() const
+    {
+        return m_segmentContainer.size();
+    }
+
+    SegmentMock& segmentAt(const uint64_t index)
+    {
+        return m_segmentContainer[index];
+    }
+
     iox::cxx::vector<SegmentMock, iox::MAX_SHM_SEGMENTS> m_segmentContainer;
 };
 
@@ -99,8 +137,15 @@ class MemPoolIntrospectionAccess
         return this->m_publisherPort;
     }
 
+    MockPublisherPortUserAccess& getStatisticsPublisherPort()
+    {
+        return this->m_statisticsPublisherPort.value();
+    }
+
     using iox::roudi::MemPoolIntrospection<MePooMemoryManager_MOCK, SegmentManagerMock, MockPublisherPortUserAccess>::
         send;
+    using iox::roudi::MemPoolIntrospection<MePooMemoryManager_MOCK, SegmentManagerMock, MockPublisherPortUserAccess>::
+        sendStatistics;
 };
 
 class MemPoolIntrospection_test : public Test
@@ -141,6 +186,7 @@ class MemPoolIntrospection_test : public Test
         info.m_minFreeChunks = index * 100 + 45;
         info.m_numChunks = index * 100 + 50;
         info.m_usedChunks = index * 100 + 3;
+        info.m_cachedChunks = index * 100 + 7;
     }
 
     // initializes the mempool info with a defined pattern
@@ -177,6 +223,10 @@ class MemPoolIntrospection_test : public Test
             {
                 return false;
             }
+            if (info.m_cachedChunks != second[index].m_cachedChunks)
+            {
+                return false;
+            }
             index++;
         }
 
@@ -215,6 +265,87 @@ TEST_F(MemPoolIntrospection_test, send_noSubscribers)
     introspectionAccess.send();
 }
 
+TEST_F(MemPoolIntrospection_test, send_withSubscribersContainsPageSizeAndNumaNodeOfSegments)
+{
+    EXPECT_CALL(callChecker(), offer()).Times(1);
+
+    MemPoolIntrospectionAccess introspectionAccess(
+        m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
+
+    ChunkMock<Topic> chunk;
+    EXPECT_CALL(introspectionAccess.getPublisherPort(), hasSubscribers()).WillOnce(Return(true));
+    EXPECT_CALL(introspectionAccess.getPublisherPort(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(iox::cxx::success<iox::mepoo::ChunkHeader*>(chunk.chunkHeader())));
+    EXPECT_CALL(introspectionAccess.getPublisherPort(), sendChunk(_)).Times(1);
+    EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Return(MemPoolInfo{0, 0, 0, 0}));
+    EXPECT_CALL(m_segmentManager_mock.m_segmentContainer.front().getMemoryManager(), getMemPoolInfo(_))
+        .WillRepeatedly(Return(MemPoolInfo{0, 0, 0, 0}));
+
+    introspectionAccess.send();
+
+    // RouDi's internal segment and the segment of the segment manager
+    ASSERT_THAT(chunk.sample()->size(), Eq(2U));
+    EXPECT_THAT(chunk.sample()->at(0).m_pageSize, Eq(iox::posix::pageSize()));
+    EXPECT_THAT(chunk.sample()->at(1).m_pageSize, Eq(SharedMemoryObjectMock::PAGE_SIZE));
+    EXPECT_THAT(chunk.sample()->at(1).m_numaNode, Eq(1));
+}
+
+TEST_F(MemPoolIntrospection_test, sendStatistics_withoutSubscribersDoesNotAllocateChunk)
+{
+    EXPECT_CALL(callChecker(), offer()).Times(2);
+
+    MemPoolIntrospectionAccess introspectionAccess(
+        m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
+    introspectionAccess.registerStatisticsPublisherPort(MockPublisherPortUserAccess());
+
+    EXPECT_CALL(introspectionAccess.getStatisticsPublisherPort(), hasSubscribers()).WillOnce(Return(false));
+    EXPECT_CALL(introspectionAccess.getStatisticsPublisherPort(), tryAllocateChunk(_, _, _, _)).Times(0);
+
+    introspectionAccess.sendStatistics();
+}
+
+TEST_F(MemPoolIntrospection_test, sendStatistics_withSubscribersContainsHistogramOfSegments)
+{
+    EXPECT_CALL(callChecker(), offer()).Times(2);
+
+    MemPoolIntrospectionAccess introspectionAccess(
+        m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
+    introspectionAccess.registerStatisticsPublisherPort(MockPublisherPortUserAccess());
+
+    constexpr uint32_t CHUNK_SIZE{256U};
+    constexpr uint32_t REQUESTED_CHUNK_SIZE{200U};
+    MemPoolInfo memPoolInfo{3U, 5U, 10U, CHUNK_SIZE};
+    memPoolInfo.m_histogram[2U].m_numberOfRequests = 42U;
+    memPoolInfo.m_histogram[2U].m_maxRequestedChunkSize = REQUESTED_CHUNK_SIZE;
+    memPoolInfo.m_histogram[2U].m_peakUsedChunks = 4U;
+
+    ChunkMock<iox::roudi::MemPoolStatisticsInfoContainer> chunk;
+    EXPECT_CALL(introspectionAccess.getStatisticsPublisherPort(), hasSubscribers()).WillOnce(Return(true));
+    EXPECT_CALL(introspectionAccess.getStatisticsPublisherPort(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(iox::cxx::success<iox::mepoo::ChunkHeader*>(chunk.chunkHeader())));
+    EXPECT_CALL(introspectionAccess.getStatisticsPublisherPort(), sendChunk(_)).Times(1);
+    EXPECT_CALL(m_segmentManager_mock.m_segmentContainer.front().getMemoryManager(), getMemPoolInfo(_))
+        .WillRepeatedly(Return(memPoolInfo));
+
+    introspectionAccess.sendStatistics();
+
+    // only the payload segments are contained, with the same id as in the mempool introspection
+    ASSERT_THAT(chunk.sample()->size(), Eq(1U));
+    const auto& statistics = chunk.sample()->front();
+    EXPECT_THAT(statistics.m_id, Eq(1U));
+    ASSERT_THAT(statistics.m_mempoolStatistics.size(), Eq(iox::MAX_NUMBER_OF_MEMPOOLS));
+    const auto& mempoolStatistics = statistics.m_mempoolStatistics.front();
+    constexpr auto CHUNK_HEADER_SIZE = static_cast<uint32_t>(sizeof(iox::mepoo::ChunkHeader));
+    EXPECT_THAT(mempoolStatistics.m_chunkPayloadSize, Eq(CHUNK_SIZE - CHUNK_HEADER_SIZE));
+    EXPECT_THAT(mempoolStatistics.m_numChunks, Eq(10U));
+    EXPECT_THAT(mempoolStatistics.m_peakUsedChunks, Eq(5U));
+    EXPECT_THAT(mempoolStatistics.m_histogram[2U].m_numberOfRequests, Eq(42U));
+    EXPECT_THAT(mempoolStatistics.m_histogram[2U].m_maxRequestedChunkPayloadSize,
+                Eq(REQUESTED_CHUNK_SIZE - CHUNK_HEADER_SIZE));
+    EXPECT_THAT(mempoolStatistics.m_histogram[2U].m_peakUsedChunks, Eq(4U));
+    EXPECT_THAT(mempoolStatistics.m_histogram[0U].m_numberOfRequests, Eq(0U));
+}
+
 /// @todo test with multiple segments and also test the mempool info from RouDiInternalMemoryManager
 /// @todo This test is not very useful as it is highly implementation-dependent and fails if the implementation changes.
 /// Should be realized as an integration test with a roudi environment and less mocking classes instead.
@@ -0,0 +1,117 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+constexpr uint32_t NUMBER_OF_ITERATIONS{200000U};
+constexpr uint32_t CHUNK_COUNT{16U};
+
+struct LoanLatency
+{
+    double average{0.0};
+    double worstCase{0.0};
+    uint32_t worstCaseChunkPayloadSize{0U};
+};
+
+/// @brief loans and releases a chunk from every one of numberOfMemPools mempools
+/// @param[in] smallestChunkPayloadSize is the chunk payload size of the first mempool
+/// @param[in] chunkPayloadSizeIncrement is added to the chunk payload size of each following mempool
+/// @return the average duration of a loan and release cycle over all mempools and the one of the slowest mempool in
+/// nanoseconds
+LoanLatency measureLoanLatency(const uint32_t numberOfMemPools,
+                               const uint32_t smallestChunkPayloadSize,
+                               const uint32_t chunkPayloadSizeIncrement)
+{
+    iox::mepoo::MePooConfig mempoolConfig;
+    for (uint32_t i = 0U; i < numberOfMemPools; ++i)
+    {
+        mempoolConfig.addMemPool({smallestChunkPayloadSize + i * chunkPayloadSizeIncrement, CHUNK_COUNT});
+    }
+
+    const auto memorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mempoolConfig);
+    std::unique_ptr<void, decltype(&free)> memory(malloc(memorySize), &free);
+    iox::posix::Allocator allocator(memory.get(), memorySize);
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, allocator, allocator);
+
+    LoanLatency latency;
+    for (uint32_t i = 0U; i < numberOfMemPools; ++i)
+    {
+        // the largest user-payload which still fits into the mempool, i.e. the lookup has to skip all smaller ones
+        const uint32_t chunkPayloadSize = smallestChunkPayloadSize + i * chunkPayloadSizeIncrement;
+        const auto chunkSettings =
+            iox::mepoo::ChunkSettings::create(chunkPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t n = 0U; n < NUMBER_OF_ITERATIONS; ++n)
+        {
+            // the SharedChunk is released at the end of the scope
+            auto chunk = memoryManager.getChunk(chunkSettings);
+            if (!chunk)
+            {
+                std::cerr << "Could not acquire a chunk!" << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        const auto duration =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+            / NUMBER_OF_ITERATIONS;
+        latency.average += duration / numberOfMemPools;
+        if (duration > latency.worstCase)
+        {
+            latency.worstCase = duration;
+            latency.worstCaseChunkPayloadSize = chunkPayloadSize;
+        }
+    }
+
+    return latency;
+}
+
+void runBenchmark(const char* description, const uint32_t smallestChunkPayloadSize, const uint32_t increment)
+{
+    std::cout << description << std::endl;
+    std::cout << std::setw(10) << "mempools"
+              << " | " << std::setw(14) << "average [ns]"
+              << " | " << std::setw(17) << "worst case [ns]"
+              << " | " << std::setw(20) << "worst case payload" << std::endl;
+    for (uint32_t numberOfMemPools = 1U; numberOfMemPools <= iox::MAX_NUMBER_OF_MEMPOOLS; numberOfMemPools *= 2U)
+    {
+        const auto latency = measureLoanLatency(numberOfMemPools, smallestChunkPayloadSize, increment);
+        std::cout << std::setw(10) << numberOfMemPools << " | " << std::setw(14) << std::fixed << std::setprecision(1)
+                  << latency.average << " | " << std::setw(17) << latency.worstCase << " | " << std::setw(20)
+                  << latency.worstCaseChunkPayloadSize << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+int main()
+{
+    runBenchmark("loan + release, mempools spread over the size classes", 64U, 64U);
+    runBenchmark("loan + release, all mempools in one size class", 4096U, 8U);
+
+    return EXIT_SUCCESS;
+}
@@ -266,22 +266,40 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
 
     wprintw(pad, "Shared memory segment reader group: ");
     prettyPrint(std::string(introspectionInfo.m_readerGroupName), PrettyOptions::bold);
+    wprintw(pad, "\n");
+
+    wprintw(pad, "Shared memory segment page size: ");
+    prettyPrint(std::to_string(introspectionInfo.m_pageSize), PrettyOptions::bold);
+    wprintw(pad, "\n");
+
+    wprintw(pad, "Shared memory segment NUMA node: ");
+    prettyPrint((introspectionInfo.m_numaNode < 0) ? std::string("unknown")
+                                                    : std::to_string(introspectionInfo.m_numaNode),
+                PrettyOptions::bold);
     wprintw(pad, "\n\n");
 
     constexpr int32_t memPoolWidth{8};
     constexpr int32_t usedchunksWidth{14};
     constexpr int32_t numchunksWidth{9};
     constexpr int32_t minFreechunksWidth{9};
+    constexpr int32_t cachedchunksWidth{7};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
+    constexpr int32_t maxChunkSizeWidth{14};
+    constexpr int32_t fragmentationWidth{12};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
+    wprintw(pad, "%*s |", cachedchunksWidth, "Cached");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", chunkPayloadSizeWidth, "Chunk Payload Size");
+    wprintw(pad, "%*s |", maxChunkSizeWidth, "Max Chunk Size");
+    wprintw(pad, "%*s\n", fragmentationWidth, "Unused Bytes");
+    wprintw(pad,
+            "----------------------------------------------------------------------------------------------------------"
+            "-------------------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -292,8 +310,11 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*d |", usedchunksWidth, info.m_usedChunks);
             wprintw(pad, "%*d |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*d |", minFreechunksWidth, info.m_minFreeChunks);
+            wprintw(pad, "%*d |", cachedchunksWidth, info.m_cachedChunks);
             wprintw(pad, "%*d |", chunkSizeWidth, info.m_chunkSize);
-            wprintw(pad, "%*d\n", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*d |", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*d |", maxChunkSizeWidth, info.m_maxChunkSize);
+            wprintw(pad, "%*llu\n", fragmentationWidth, static_cast<unsigned long long>(info.m_internalFragmentation));
         }
     }
     wprintw(pad, "\n");
@@ -0,0 +1,127 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+#include "iceoryx_posh/roudi/mempool_config_generator.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <chrono>
+#include <getopt.h>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+constexpr char APP_NAME[] = "iox-mempool-config-generator";
+constexpr std::chrono::milliseconds WAIT_INTERVAL{100};
+constexpr uint32_t NUMBER_OF_WAIT_INTERVALS_TILL_TIMEOUT{50U};
+
+void printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  "
+              << APP_NAME
+              << " [OPTIONS]\n"
+                 "\nPrints a mempool config in TOML format which is generated from the allocation statistics of the\n"
+                 "running RouDi.\n"
+                 "\nOptions:\n"
+                 "  -h, --help                Display help and exit.\n"
+                 "  -r, --headroom <percent>  Chunks in percent of the peak of the used chunks which are added to\n"
+                 "                            each mempool [default: "
+              << iox::roudi::MemPoolConfigGenerator::DEFAULT_HEADROOM_PERCENT << "]\n"
+              << std::endl;
+}
+
+void printConfig(const iox::roudi::MemPoolStatisticsInfoContainer& statistics, const uint32_t headroomPercent) noexcept
+{
+    const iox::roudi::MemPoolConfigGenerator generator(headroomPercent);
+
+    std::cout << "# generated by " << APP_NAME << " with a headroom of " << headroomPercent << "%\n"
+              << "[general]\n"
+              << "version = 1\n";
+    for (const auto& segment : statistics)
+    {
+        std::cout << "\n[[segment]]\n"
+                  << "reader = \"" << segment.m_readerGroupName << "\"\n"
+                  << "writer = \"" << segment.m_writerGroupName << "\"\n";
+        for (const auto& mempool : generator.generate(segment).m_mempoolConfig)
+        {
+            std::cout << "\n[[segment.mempool]]\n"
+                      << "size = " << mempool.m_size << "\n"
+                      << "count = " << mempool.m_chunkCount << "\n";
+        }
+    }
+    std::cout << std::flush;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    uint32_t headroomPercent{iox::roudi::MemPoolConfigGenerator::DEFAULT_HEADROOM_PERCENT};
+
+    constexpr option LONG_OPTIONS[] = {
+        {"help", no_argument, nullptr, 'h'}, {"headroom", required_argument, nullptr, 'r'}, {nullptr, 0, nullptr, 0}};
+    int opt{0};
+    int index{0};
+    while ((opt = getopt_long(argc, argv, "hr:", LONG_OPTIONS, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        case 'r':
+            if (!iox::cxx::convert::fromString(optarg, headroomPercent))
+            {
+                std::cerr << "Invalid argument for `r`!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        default:
+            printHelp();
+            return EXIT_FAILURE;
+        }
+    }
+
+    iox::runtime::PoshRuntime::initRuntime(APP_NAME);
+
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 1U;
+    subscriberOptions.historyRequest = 1U;
+    iox::popo::Subscriber<iox::roudi::MemPoolStatisticsInfoContainer> subscriber(
+        iox::roudi::IntrospectionMemPoolStatisticsService, subscriberOptions);
+
+    // RouDi sends the statistics only while there are subscribers, therefore the first sample arrives with the next
+    // send interval of the mempool introspection
+    for (uint32_t i = 0U; i < NUMBER_OF_WAIT_INTERVALS_TILL_TIMEOUT; ++i)
+    {
+        bool hasReceivedSample{false};
+        subscriber.take().and_then([&](auto& sample) {
+            printConfig(*sample, headroomPercent);
+            hasReceivedSample = true;
+        });
+        if (hasReceivedSample)
+        {
+            return EXIT_SUCCESS;
+        }
+        std::this_thread::sleep_for(WAIT_INTERVAL);
+    }
+
+    std::cerr << "Timeout while waiting for the mempool statistics of RouDi!" << std::endl;
+    return EXIT_FAILURE;
+}